@@ -0,0 +1,548 @@
+#pragma once
+
+#include "Assert.h"
+#include "Macros.h"
+#include "Memory.h"
+#include "TypeTraits.h"
+
+#include <bit>
+#include <cstdint>
+
+#if defined(KW_SIMD_SSE2) || defined(KW_SIMD_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace kw::Algorithms
+{
+
+// Algorithms over contiguous arrays. Arrays of integers, floats and doubles are processed with SSE2 or AVX2, whichever
+// is enabled at compile time (see Macros.h). Other types use a plain loop over `operator==` and `operator<`.
+
+// Return a pointer to the first element that is equal to the given value, or `Data + Size` if there's none.
+template<class T>
+const T* Find(const T* Data, size_t Size, const T& Value);
+
+// Return how many elements are equal to the given value.
+template<class T>
+size_t Count(const T* Data, size_t Size, const T& Value);
+
+// Return the index of the first element that is not equal to the element with the same index in the other array,
+// or `Size` if the arrays are equal.
+template<class T>
+size_t Mismatch(const T* Lhs, const T* Rhs, size_t Size);
+
+// Return whether two arrays of the same size are equal.
+template<class T>
+bool Equal(const T* Lhs, const T* Rhs, size_t Size);
+
+// Lexicographically compare two arrays. Return a negative value if the first array is less, a positive value if it's
+// greater, and zero if the arrays are equal.
+template<class T>
+int Compare(const T* Lhs, size_t LhsSize, const T* Rhs, size_t RhsSize);
+
+// Return the first smallest element. The array must not be empty. Unspecified for floating-point arrays with NaNs.
+template<class T>
+const T& Min(const T* Data, size_t Size);
+
+// Return the first largest element. The array must not be empty. Unspecified for floating-point arrays with NaNs.
+template<class T>
+const T& Max(const T* Data, size_t Size);
+
+} // namespace kw::Algorithms
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kw::Algorithms::Details
+{
+
+#if defined(KW_SIMD_AVX2) || defined(KW_SIMD_SSE2)
+
+// Whether arrays of the given type are processed with SIMD. Integers are compared bitwise, floating-point numbers are
+// compared with floating-point instructions, so that -0.0 is equal to 0.0 and NaN is not equal to anything.
+template<class T>
+static constexpr bool IsVectorizable = (TypeTraits::IsIntegral<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+                                       TypeTraits::IsSame<T, float> || TypeTraits::IsSame<T, double>;
+
+#if defined(KW_SIMD_AVX2)
+
+using Block = __m256i;
+using Mask = uint32_t;
+
+static constexpr size_t BlockSize = 32;
+static constexpr Mask FullMask = 0xFFFFFFFF;
+
+inline Block Load(const void* Address)
+{
+	return _mm256_loadu_si256(static_cast<const __m256i*>(Address));
+}
+
+inline void Store(void* Address, Block Value)
+{
+	_mm256_storeu_si256(static_cast<__m256i*>(Address), Value);
+}
+
+// Return a byte mask where all bytes of equal elements are set.
+template<class T>
+Mask EqualMask(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(Lhs), _mm256_castsi256_ps(Rhs), _CMP_EQ_OQ))));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(Lhs), _mm256_castsi256_pd(Rhs), _CMP_EQ_OQ))));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Lhs, Rhs)));
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_cmpeq_epi16(Lhs, Rhs)));
+	}
+	else if constexpr (sizeof(T) == 4)
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_cmpeq_epi32(Lhs, Rhs)));
+	}
+	else
+	{
+		return Mask(_mm256_movemask_epi8(_mm256_cmpeq_epi64(Lhs, Rhs)));
+	}
+}
+
+// Whether `MinBlock` and `MaxBlock` are available for the given type.
+template<class T>
+static constexpr bool HasMinMax = TypeTraits::IsSame<T, float> || TypeTraits::IsSame<T, double> ||
+                                  (TypeTraits::IsIntegral<T> && sizeof(T) <= 4);
+
+template<class T>
+Block MinBlock(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(Lhs), _mm256_castsi256_ps(Rhs)));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(Lhs), _mm256_castsi256_pd(Rhs)));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_min_epi8(Lhs, Rhs) : _mm256_min_epu8(Lhs, Rhs);
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_min_epi16(Lhs, Rhs) : _mm256_min_epu16(Lhs, Rhs);
+	}
+	else
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_min_epi32(Lhs, Rhs) : _mm256_min_epu32(Lhs, Rhs);
+	}
+}
+
+template<class T>
+Block MaxBlock(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(Lhs), _mm256_castsi256_ps(Rhs)));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(Lhs), _mm256_castsi256_pd(Rhs)));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_max_epi8(Lhs, Rhs) : _mm256_max_epu8(Lhs, Rhs);
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_max_epi16(Lhs, Rhs) : _mm256_max_epu16(Lhs, Rhs);
+	}
+	else
+	{
+		return TypeTraits::IsSigned<T> ? _mm256_max_epi32(Lhs, Rhs) : _mm256_max_epu32(Lhs, Rhs);
+	}
+}
+
+#else
+
+using Block = __m128i;
+using Mask = uint32_t;
+
+static constexpr size_t BlockSize = 16;
+static constexpr Mask FullMask = 0xFFFF;
+
+inline Block Load(const void* Address)
+{
+	return _mm_loadu_si128(static_cast<const __m128i*>(Address));
+}
+
+inline void Store(void* Address, Block Value)
+{
+	_mm_storeu_si128(static_cast<__m128i*>(Address), Value);
+}
+
+// Return a byte mask where all bytes of equal elements are set.
+template<class T>
+Mask EqualMask(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return Mask(_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(Lhs), _mm_castsi128_ps(Rhs)))));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return Mask(_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(Lhs), _mm_castsi128_pd(Rhs)))));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return Mask(_mm_movemask_epi8(_mm_cmpeq_epi8(Lhs, Rhs)));
+	}
+	else if constexpr (sizeof(T) == 2)
+	{
+		return Mask(_mm_movemask_epi8(_mm_cmpeq_epi16(Lhs, Rhs)));
+	}
+	else if constexpr (sizeof(T) == 4)
+	{
+		return Mask(_mm_movemask_epi8(_mm_cmpeq_epi32(Lhs, Rhs)));
+	}
+	else
+	{
+		// SSE2 can't compare 64-bit integers, compare halves and require both of them to be equal.
+		__m128i Halves = _mm_cmpeq_epi32(Lhs, Rhs);
+		return Mask(_mm_movemask_epi8(_mm_and_si128(Halves, _mm_shuffle_epi32(Halves, _MM_SHUFFLE(2, 3, 0, 1)))));
+	}
+}
+
+// Whether `MinBlock` and `MaxBlock` are available for the given type. SSE2 only has a few of them.
+template<class T>
+static constexpr bool HasMinMax = TypeTraits::IsSame<T, float> || TypeTraits::IsSame<T, double> ||
+                                  (TypeTraits::IsIntegral<T> && sizeof(T) == 1 && !TypeTraits::IsSigned<T>) ||
+                                  (TypeTraits::IsIntegral<T> && sizeof(T) == 2 && TypeTraits::IsSigned<T>);
+
+template<class T>
+Block MinBlock(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(Lhs), _mm_castsi128_ps(Rhs)));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(Lhs), _mm_castsi128_pd(Rhs)));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return _mm_min_epu8(Lhs, Rhs);
+	}
+	else
+	{
+		return _mm_min_epi16(Lhs, Rhs);
+	}
+}
+
+template<class T>
+Block MaxBlock(Block Lhs, Block Rhs)
+{
+	if constexpr (TypeTraits::IsSame<T, float>)
+	{
+		return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(Lhs), _mm_castsi128_ps(Rhs)));
+	}
+	else if constexpr (TypeTraits::IsSame<T, double>)
+	{
+		return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(Lhs), _mm_castsi128_pd(Rhs)));
+	}
+	else if constexpr (sizeof(T) == 1)
+	{
+		return _mm_max_epu8(Lhs, Rhs);
+	}
+	else
+	{
+		return _mm_max_epi16(Lhs, Rhs);
+	}
+}
+
+#endif // defined(KW_SIMD_AVX2)
+
+// Number of elements of the given type in a block.
+template<class T>
+static constexpr size_t BlockCount = BlockSize / sizeof(T);
+
+// Return a block with all elements equal to the given value.
+template<class T>
+Block Broadcast(const T& Value)
+{
+	T Values[BlockCount<T>];
+	for (size_t Index = 0; Index < BlockCount<T>; Index++)
+	{
+		Values[Index] = Value;
+	}
+	return Load(Values);
+}
+
+// Reduce the given array with the given block and scalar functions. Blocks may overlap, which is fine for min and max.
+template<class T, class BlockFunction, class ScalarFunction>
+const T& Reduce(const T* Data, size_t Size, BlockFunction&& BlockCallback, ScalarFunction&& ScalarCallback)
+{
+	const T* Result = Data;
+	if (Size >= BlockCount<T>)
+	{
+		Block Accumulator = Load(Data);
+		for (size_t Index = BlockCount<T>; Index < Size; Index += BlockCount<T>)
+		{
+			// The last block is aligned to the end of the array and overlaps the previous one.
+			size_t Offset = Index + BlockCount<T> <= Size ? Index : Size - BlockCount<T>;
+			Accumulator = BlockCallback(Accumulator, Load(Data + Offset));
+		}
+
+		T Values[BlockCount<T>];
+		Store(Values, Accumulator);
+
+		T Value = Values[0];
+		for (size_t Index = 1; Index < BlockCount<T>; Index++)
+		{
+			if (ScalarCallback(Values[Index], Value))
+			{
+				Value = Values[Index];
+			}
+		}
+
+		// The reduced value is a copy, find the element it was copied from.
+		Result = Find(Data, Size, Value);
+		if (Result != Data + Size)
+		{
+			return *Result;
+		}
+
+		// Not found only for NaNs, fall back to the scalar loop.
+		Result = Data;
+	}
+
+	for (size_t Index = 1; Index < Size; Index++)
+	{
+		if (ScalarCallback(Data[Index], *Result))
+		{
+			Result = Data + Index;
+		}
+	}
+	return *Result;
+}
+
+#else
+
+template<class T>
+static constexpr bool IsVectorizable = false;
+
+#endif // defined(KW_SIMD_AVX2) || defined(KW_SIMD_SSE2)
+
+} // namespace kw::Algorithms::Details
+
+namespace kw::Algorithms
+{
+
+template<class T>
+const T* Find(const T* Data, size_t Size, const T& Value)
+{
+	if constexpr (Details::IsVectorizable<T>)
+	{
+		constexpr size_t BlockCount = Details::BlockCount<T>;
+
+		if (Size >= BlockCount)
+		{
+			Details::Block Needle = Details::Broadcast(Value);
+
+			for (size_t Index = 0; Index < Size; Index += BlockCount)
+			{
+				// The last block is aligned to the end of the array. Overlapped elements are known to be not equal.
+				size_t Offset = Index + BlockCount <= Size ? Index : Size - BlockCount;
+
+				Details::Mask Mask = Details::EqualMask<T>(Details::Load(Data + Offset), Needle);
+				if (Mask != 0)
+				{
+					return Data + Offset + std::countr_zero(Mask) / sizeof(T);
+				}
+			}
+
+			return Data + Size;
+		}
+	}
+
+	for (size_t Index = 0; Index < Size; Index++)
+	{
+		if (Data[Index] == Value)
+		{
+			return Data + Index;
+		}
+	}
+
+	return Data + Size;
+}
+
+template<class T>
+size_t Count(const T* Data, size_t Size, const T& Value)
+{
+	size_t Result = 0;
+	size_t Index = 0;
+
+	if constexpr (Details::IsVectorizable<T>)
+	{
+		constexpr size_t BlockCount = Details::BlockCount<T>;
+
+		Details::Block Needle = Details::Broadcast(Value);
+
+		for (; Index + BlockCount <= Size; Index += BlockCount)
+		{
+			// Every equal element sets `sizeof(T)` bits.
+			Result += std::popcount(Details::EqualMask<T>(Details::Load(Data + Index), Needle));
+		}
+
+		Result /= sizeof(T);
+	}
+
+	for (; Index < Size; Index++)
+	{
+		if (Data[Index] == Value)
+		{
+			Result++;
+		}
+	}
+
+	return Result;
+}
+
+template<class T>
+size_t Mismatch(const T* Lhs, const T* Rhs, size_t Size)
+{
+	if constexpr (Details::IsVectorizable<T>)
+	{
+		constexpr size_t BlockCount = Details::BlockCount<T>;
+
+		if (Size >= BlockCount)
+		{
+			for (size_t Index = 0; Index < Size; Index += BlockCount)
+			{
+				// The last block is aligned to the end of the array. Overlapped elements are known to be equal.
+				size_t Offset = Index + BlockCount <= Size ? Index : Size - BlockCount;
+
+				Details::Mask Mask = ~Details::EqualMask<T>(Details::Load(Lhs + Offset), Details::Load(Rhs + Offset)) & Details::FullMask;
+				if (Mask != 0)
+				{
+					return Offset + std::countr_zero(Mask) / sizeof(T);
+				}
+			}
+
+			return Size;
+		}
+	}
+
+	for (size_t Index = 0; Index < Size; Index++)
+	{
+		if (!(Lhs[Index] == Rhs[Index]))
+		{
+			return Index;
+		}
+	}
+
+	return Size;
+}
+
+template<class T>
+bool Equal(const T* Lhs, const T* Rhs, size_t Size)
+{
+	if constexpr (TypeTraits::IsIntegral<T>)
+	{
+		// Integers have no padding and no special values, so they're equal if and only if they're bitwise equal.
+		return Size == 0 || Memory::Memcmp(Lhs, Rhs, sizeof(T) * Size) == 0;
+	}
+	else
+	{
+		return Mismatch(Lhs, Rhs, Size) == Size;
+	}
+}
+
+template<class T>
+int Compare(const T* Lhs, size_t LhsSize, const T* Rhs, size_t RhsSize)
+{
+	size_t Size = LhsSize < RhsSize ? LhsSize : RhsSize;
+
+	if constexpr (TypeTraits::IsIntegral<T> && sizeof(T) == 1 && !TypeTraits::IsSigned<T>)
+	{
+		// Memcmp compares unsigned bytes, which is exactly the lexicographical order of unsigned byte arrays.
+		int Result = Size != 0 ? Memory::Memcmp(Lhs, Rhs, Size) : 0;
+		if (Result != 0)
+		{
+			return Result;
+		}
+	}
+	else
+	{
+		for (size_t Index = Mismatch(Lhs, Rhs, Size); Index < Size; Index += 1 + Mismatch(Lhs + Index + 1, Rhs + Index + 1, Size - Index - 1))
+		{
+			if (Lhs[Index] < Rhs[Index])
+			{
+				return -1;
+			}
+
+			if (Rhs[Index] < Lhs[Index])
+			{
+				return 1;
+			}
+
+			// Neither is less, e.g. NaNs. Such elements are equivalent, continue with the next mismatch.
+		}
+	}
+
+	return LhsSize < RhsSize ? -1 : (LhsSize > RhsSize ? 1 : 0);
+}
+
+template<class T>
+const T& Min(const T* Data, size_t Size)
+{
+	KW_ASSERT(Size > 0);
+
+	if constexpr (Details::IsVectorizable<T>)
+	{
+		if constexpr (Details::HasMinMax<T>)
+		{
+			return Details::Reduce(Data, Size, &Details::MinBlock<T>, [](const T& Lhs, const T& Rhs) { return Lhs < Rhs; });
+		}
+	}
+
+	const T* Result = Data;
+	for (size_t Index = 1; Index < Size; Index++)
+	{
+		if (Data[Index] < *Result)
+		{
+			Result = Data + Index;
+		}
+	}
+	return *Result;
+}
+
+template<class T>
+const T& Max(const T* Data, size_t Size)
+{
+	KW_ASSERT(Size > 0);
+
+	if constexpr (Details::IsVectorizable<T>)
+	{
+		if constexpr (Details::HasMinMax<T>)
+		{
+			return Details::Reduce(Data, Size, &Details::MaxBlock<T>, [](const T& Lhs, const T& Rhs) { return Rhs < Lhs; });
+		}
+	}
+
+	const T* Result = Data;
+	for (size_t Index = 1; Index < Size; Index++)
+	{
+		if (*Result < Data[Index])
+		{
+			Result = Data + Index;
+		}
+	}
+	return *Result;
+}
+
+} // namespace kw::Algorithms
@@ -1,9 +1,11 @@
 #pragma once
 
+#include "Algorithms.h"
 #include "Assert.h"
 #include "Concepts.h"
 #include "ContainerUtils.h"
 #include "Iterators.h"
+#include "Utility.h"
 
 namespace kw
 {
@@ -69,6 +71,21 @@ public:
 	// Return the underlying array. May be null.
 	const ValueType* GetData() const;
 
+	// Return an iterator to the first element equal to the given value, or the end iterator if there's none.
+	Iterator Find(const ValueType& Value) const;
+
+	// Return whether the view contains an element equal to the given value.
+	bool Contains(const ValueType& Value) const;
+
+	// Return how many elements are equal to the given value.
+	size_t Count(const ValueType& Value) const;
+
+	// Return the first smallest element. The view must not be empty.
+	const ValueType& GetMin() const;
+
+	// Return the first largest element. The view must not be empty.
+	const ValueType& GetMax() const;
+
 	// Return whether two views are equal.
 	bool operator==(const ArrayView& Other) const;
 
@@ -92,6 +109,13 @@ private:
 	size_t mSize;
 };
 
+// Hash of array views of integers hashes their bytes, so e.g. an `ArrayView<uint8_t>` can be a key of hash containers.
+template<Integral T>
+struct Hash<ArrayView<T>>
+{
+	size_t operator()(ArrayView<T> Value) const;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<class T>
@@ -202,23 +226,44 @@ const ArrayView<T>::ValueType* ArrayView<T>::GetData() const
 	return mData;
 }
 
+template<class T>
+ArrayView<T>::Iterator ArrayView<T>::Find(const ValueType& Value) const
+{
+	return Iterator(Algorithms::Find(mData, mSize, Value));
+}
+
+template<class T>
+bool ArrayView<T>::Contains(const ValueType& Value) const
+{
+	return Algorithms::Find(mData, mSize, Value) != mData + mSize;
+}
+
+template<class T>
+size_t ArrayView<T>::Count(const ValueType& Value) const
+{
+	return Algorithms::Count(mData, mSize, Value);
+}
+
+template<class T>
+const ArrayView<T>::ValueType& ArrayView<T>::GetMin() const
+{
+	KW_ASSERT(!IsEmpty());
+
+	return Algorithms::Min(mData, mSize);
+}
+
+template<class T>
+const ArrayView<T>::ValueType& ArrayView<T>::GetMax() const
+{
+	KW_ASSERT(!IsEmpty());
+
+	return Algorithms::Max(mData, mSize);
+}
+
 template<class T>
 bool ArrayView<T>::operator==(const ArrayView& Other) const
 {
-	if (mSize != Other.mSize)
-	{
-		return false;
-	}
-
-	for (size_t Index = 0; Index < mSize; Index++)
-	{
-		if (mData[Index] != Other.mData[Index])
-		{
-			return false;
-		}
-	}
-
-	return true;
+	return mSize == Other.mSize && Algorithms::Equal(mData, Other.mData, mSize);
 }
 
 template<class T>
@@ -230,15 +275,7 @@ bool ArrayView<T>::operator!=(const ArrayView& Other) const
 template<class T>
 bool ArrayView<T>::operator<(const ArrayView& Other) const
 {
-	for (size_t Index = 0, Size = mSize < Other.mSize ? mSize : Other.mSize; Index < Size; Index++)
-	{
-		if (!(mData[Index] < Other.mData[Index]))
-		{
-			return false;
-		}
-	}
-
-	return mSize < Other.mSize;
+	return Algorithms::Compare(mData, mSize, Other.mData, Other.mSize) < 0;
 }
 
 template<class T>
@@ -259,4 +296,10 @@ bool ArrayView<T>::operator>=(const ArrayView& Other) const
 	return !(*this < Other);
 }
 
+template<Integral T>
+size_t Hash<ArrayView<T>>::operator()(ArrayView<T> Value) const
+{
+	return HashBytes(Value.GetData(), sizeof(T) * Value.GetSize());
+}
+
 } // namespace kw
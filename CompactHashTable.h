@@ -0,0 +1,1051 @@
+#pragma once
+
+#include "Assert.h"
+#include "HashTraits.h"
+#include "Macros.h"
+#include "Memory.h"
+#include "Pair.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace kw
+{
+
+template<class Traits, auto EmptyKey>
+class CompactHashTable;
+
+namespace HashDetails
+{
+
+// Unsigned integer of the given size in bytes.
+template<size_t Size>
+struct UnsignedOfSize;
+
+template<>
+struct UnsignedOfSize<1>
+{
+	using Type = uint8_t;
+};
+
+template<>
+struct UnsignedOfSize<2>
+{
+	using Type = uint16_t;
+};
+
+template<>
+struct UnsignedOfSize<4>
+{
+	using Type = uint32_t;
+};
+
+template<>
+struct UnsignedOfSize<8>
+{
+	using Type = uint64_t;
+};
+
+// Slots of `CompactHashTable` don't have any metadata. An empty slot stores the reserved key, and the sentinels
+// before the first and after the last slot store any other key. Keys are compared bitwise, so the reserved key of
+// floating point keys can be any NaN. Keys must be the first member of elements.
+template<class Key, auto EmptyKey>
+struct CompactSlot
+{
+	using BitsType = typename UnsignedOfSize<sizeof(Key)>::Type;
+
+	static constexpr BitsType EmptyBits = std::bit_cast<BitsType>(static_cast<Key>(EmptyKey));
+	static constexpr BitsType SentinelBits = EmptyBits ^ 1;
+
+	static BitsType GetBits(const void* Slot);
+	static bool IsEmpty(const void* Slot);
+	static void SetBits(void* Slot, BitsType Bits);
+};
+
+} // namespace HashDetails
+
+// Bidirectional iterator over elements of `CompactHashTable`. Empty slots are skipped, so an increment is amortized
+// constant.
+template<class T, class SlotType>
+class CompactHashIterator
+{
+public:
+	using ValueType = T;
+
+	CompactHashIterator() = default;
+	explicit CompactHashIterator(T* InElement);
+	CompactHashIterator(const CompactHashIterator<TypeTraits::RemoveConst<T>, SlotType>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	CompactHashIterator& operator++();
+	CompactHashIterator operator++(int);
+
+	CompactHashIterator& operator--();
+	CompactHashIterator operator--(int);
+
+	friend auto operator<=>(const CompactHashIterator& Lhs, const CompactHashIterator& Rhs) = default;
+
+private:
+	template<class U, class V>
+	friend class CompactHashIterator;
+
+	template<class Traits, auto EmptyKey>
+	friend class CompactHashTable;
+
+	T* mElement;
+};
+
+// Open addressing table for small trivially copyable keys (1, 2, 4, or 8 bytes) that stores nothing but the elements,
+// so a `HashSet<uint32_t>` takes 4 bytes per slot. Empty slots hold the reserved `EmptyKey`, which can't be inserted.
+// Elements are kept sorted by home slot like in `RobinHoodHashTable`, but instead of storing probe distances they're
+// recomputed from the keys, which is cheap for integer hashes. The number of home slots is not limited to powers of
+// two, so `Reserve` allocates just enough slots for the maximum load factor, and a full table grows by only a quarter.
+// See `HashBase` for the interface.
+template<class Traits, auto EmptyKey>
+class CompactHashTable : protected Traits::AllocatorType
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	static_assert(TypeTraits::IsTriviallyCopyable<KeyType>, "Keys of compact hash tables must be trivially copyable.");
+	static_assert(sizeof(KeyType) == 1 || sizeof(KeyType) == 2 || sizeof(KeyType) == 4 || sizeof(KeyType) == 8, "Keys of compact hash tables must be 1, 2, 4, or 8 bytes.");
+
+	using SlotType = HashDetails::CompactSlot<KeyType, EmptyKey>;
+
+	using Iterator = CompactHashIterator<ElementType, SlotType>;
+	using ConstIterator = CompactHashIterator<const ElementType, SlotType>;
+
+	explicit CompactHashTable(const AllocatorType& InAllocator);
+	CompactHashTable(const CompactHashTable& Other);
+	CompactHashTable(CompactHashTable&& Other);
+	~CompactHashTable();
+
+	template<class OtherTraits>
+	CompactHashTable(const CompactHashTable<OtherTraits, EmptyKey>& Other, const AllocatorType& InAllocator);
+
+	CompactHashTable& operator=(const CompactHashTable& Other);
+	CompactHashTable& operator=(CompactHashTable&& Other);
+
+	void Reserve(size_t Capacity);
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+
+	// Reallocate the table with the least number of home slots that fits the given number of elements and all the
+	// current ones. An empty table with zero capacity frees its memory.
+	void Rehash(size_t Capacity);
+
+	// Return the index of the first element with the given key or `GetEndIndex()` if it doesn't exist. The key is
+	// either `KeyType` or a `HashLookupKey`.
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+
+	// Return the index past the last element of the run of equal keys that starts at the given index.
+	size_t FindRunEnd(size_t Index) const;
+
+	// For unique keys, return the index of an existing element with the given key and false, if there's one.
+	// Otherwise make room for a new element and return its index and true. The caller constructs the element.
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+
+	// Return whether an insertion of a new element may rehash the table.
+	bool IsFull() const;
+
+	// Start loading the memory of the home slot of the given hash.
+	void Prefetch(size_t Hash) const;
+
+	// Destroy the element at the given index. Return the index of the element that follows it in the iteration order.
+	size_t EraseIndex(size_t Index);
+
+	// Destroy the run of equal keys of the given length that starts at the given index. Keys aren't compared, so the
+	// elements of the run may be moved from already.
+	void EraseRun(size_t Index, size_t Count);
+
+	// Return the index of the first element starting from the given index, or `GetEndIndex()`.
+	size_t SkipEmpty(size_t Index) const;
+
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	// Iterators to the first element, past the last element, to the last element, and before the first element.
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits, auto OtherEmptyKey>
+	friend class CompactHashTable;
+
+	// The number of elements never exceeds the maximum load factor times the number of home slots.
+	static constexpr float DefaultMaxLoadFactor = 0.875f;
+	static constexpr float MinMaxLoadFactor = 0.125f;
+	static constexpr float MaxMaxLoadFactor = 0.95f;
+
+	// Minimum number of home slots of a non-empty table.
+	static constexpr size_t MinCapacity = 8;
+
+	// A full table grows by a quarter instead of doubling, so the memory of a table that grows without `Reserve` stays
+	// within 1.43x of the elements, at the cost of moving every element about four times instead of once.
+	static constexpr size_t GrowthShift = 2;
+
+	// Slots after the last home slot let the probe sequence run past the end without wrapping around. The last slot
+	// is always empty, so probes and shifts stop there without bound checks.
+	static constexpr size_t MaxOverflow = 64;
+
+	using ElementAllocator = typename HashDetails::RebindAllocator<AllocatorType, ElementType>::Type;
+
+	// Return whether the slot at the given index is empty.
+	bool IsEmpty(size_t Index) const;
+
+	// Return how many elements the given number of home slots can store.
+	size_t GetMaxSize(size_t Capacity) const;
+
+	// Return the least number of home slots that can store the given number of elements.
+	size_t GetMinCapacity(size_t Size) const;
+
+	// Return the home slot of the given hash.
+	size_t GetHomeIndex(size_t Hash) const;
+
+	// Return the home slot of the element at the given index.
+	size_t GetElementHomeIndex(size_t Index) const;
+
+	// Make room for a new element at the given index by shifting the following elements.
+	void PrepareInsert(size_t Index);
+
+	// Move all elements to a table with the given number of home slots.
+	void RehashElements(size_t Capacity);
+
+	// Reallocate the table with a larger overflow area. Elements keep their indices.
+	void ExtendOverflow();
+
+	// Copy the elements from the given table into this empty table.
+	template<class OtherTable>
+	void CopyElements(const OtherTable& Other);
+
+	void DestroyElements();
+
+	ElementType* AllocateSlots(size_t SlotCount);
+	void DeallocateSlots(ElementType* Slots);
+
+	ElementType* mSlots;
+	size_t mSize;
+
+	// Number of home slots. Either zero or at least `MinCapacity`.
+	size_t mCapacity;
+
+	// Number of home slots plus the overflow area.
+	size_t mSlotCount;
+
+	// Number of elements that fit into the home slots at the maximum load factor.
+	size_t mMaxSize;
+
+	float mMaxLoadFactor;
+};
+
+// Layout of hash containers that uses `CompactHashTable`, e.g. `HashSet<uint32_t, Hash<uint32_t>, EqualTo<uint32_t>,
+// MallocAllocator<uint32_t>, CompactHashLayout<>>`. The given key, converted to the key type, marks empty slots and
+// must never be inserted. Uses the least memory for small keys, especially when the size is known in advance.
+template<auto EmptyKey = -1>
+struct CompactHashLayout
+{
+	template<class Traits>
+	using Table = CompactHashTable<Traits, EmptyKey>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, auto EmptyKey>
+typename HashDetails::CompactSlot<Key, EmptyKey>::BitsType HashDetails::CompactSlot<Key, EmptyKey>::GetBits(const void* Slot)
+{
+	BitsType Bits;
+	std::memcpy(&Bits, Slot, sizeof(BitsType));
+	return Bits;
+}
+
+template<class Key, auto EmptyKey>
+bool HashDetails::CompactSlot<Key, EmptyKey>::IsEmpty(const void* Slot)
+{
+	return GetBits(Slot) == EmptyBits;
+}
+
+template<class Key, auto EmptyKey>
+void HashDetails::CompactSlot<Key, EmptyKey>::SetBits(void* Slot, BitsType Bits)
+{
+	std::memcpy(Slot, &Bits, sizeof(BitsType));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType>::CompactHashIterator(T* InElement)
+	: mElement(InElement)
+{
+}
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType>::CompactHashIterator(const CompactHashIterator<TypeTraits::RemoveConst<T>, SlotType>& Other)
+	: mElement(Other.mElement)
+{
+}
+
+template<class T, class SlotType>
+typename CompactHashIterator<T, SlotType>::ValueType& CompactHashIterator<T, SlotType>::operator*() const
+{
+	return *mElement;
+}
+
+template<class T, class SlotType>
+typename CompactHashIterator<T, SlotType>::ValueType* CompactHashIterator<T, SlotType>::operator->() const
+{
+	return mElement;
+}
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType>& CompactHashIterator<T, SlotType>::operator++()
+{
+	// The sentinel after the last slot is not empty, so there's no need for bound checks.
+	do
+	{
+		++mElement;
+	}
+	while (SlotType::IsEmpty(mElement));
+
+	return *this;
+}
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType> CompactHashIterator<T, SlotType>::operator++(int)
+{
+	CompactHashIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType>& CompactHashIterator<T, SlotType>::operator--()
+{
+	do
+	{
+		--mElement;
+	}
+	while (SlotType::IsEmpty(mElement));
+
+	return *this;
+}
+
+template<class T, class SlotType>
+CompactHashIterator<T, SlotType> CompactHashIterator<T, SlotType>::operator--(int)
+{
+	CompactHashIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>::CompactHashTable(const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mSlots(nullptr)
+	, mSize(0)
+	, mCapacity(0)
+	, mSlotCount(0)
+	, mMaxSize(0)
+	, mMaxLoadFactor(DefaultMaxLoadFactor)
+{
+}
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>::CompactHashTable(const CompactHashTable& Other)
+	: CompactHashTable(Other.GetAllocator())
+{
+	CopyElements(Other);
+}
+
+template<class Traits, auto EmptyKey>
+template<class OtherTraits>
+CompactHashTable<Traits, EmptyKey>::CompactHashTable(const CompactHashTable<OtherTraits, EmptyKey>& Other, const AllocatorType& InAllocator)
+	: CompactHashTable(InAllocator)
+{
+	CopyElements(Other);
+}
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>::CompactHashTable(CompactHashTable&& Other)
+	: AllocatorType(static_cast<AllocatorType&&>(Other))
+	, mSlots(Other.mSlots)
+	, mSize(Other.mSize)
+	, mCapacity(Other.mCapacity)
+	, mSlotCount(Other.mSlotCount)
+	, mMaxSize(Other.mMaxSize)
+	, mMaxLoadFactor(Other.mMaxLoadFactor)
+{
+	Other.mSlots = nullptr;
+	Other.mSize = 0;
+	Other.mCapacity = 0;
+	Other.mSlotCount = 0;
+	Other.mMaxSize = 0;
+}
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>::~CompactHashTable()
+{
+	DestroyElements();
+	DeallocateSlots(mSlots);
+}
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>& CompactHashTable<Traits, EmptyKey>::operator=(const CompactHashTable& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateSlots(mSlots);
+
+		mSlots = nullptr;
+		mSize = 0;
+		mCapacity = 0;
+		mSlotCount = 0;
+		mMaxSize = 0;
+
+		CopyElements(Other);
+	}
+	return *this;
+}
+
+template<class Traits, auto EmptyKey>
+CompactHashTable<Traits, EmptyKey>& CompactHashTable<Traits, EmptyKey>::operator=(CompactHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateSlots(mSlots);
+
+		static_cast<AllocatorType&>(*this) = static_cast<AllocatorType&&>(Other);
+
+		mSlots = Other.mSlots;
+		mSize = Other.mSize;
+		mCapacity = Other.mCapacity;
+		mSlotCount = Other.mSlotCount;
+		mMaxSize = Other.mMaxSize;
+		mMaxLoadFactor = Other.mMaxLoadFactor;
+
+		Other.mSlots = nullptr;
+		Other.mSize = 0;
+		Other.mCapacity = 0;
+		Other.mSlotCount = 0;
+		Other.mMaxSize = 0;
+	}
+	return *this;
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::Reserve(size_t Capacity)
+{
+	size_t NewCapacity = GetMinCapacity(Capacity);
+	if (NewCapacity > mCapacity)
+	{
+		RehashElements(NewCapacity);
+	}
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::Clear()
+{
+	DestroyElements();
+
+	for (size_t i = 0; i < mSlotCount; i++)
+	{
+		SlotType::SetBits(mSlots + i, SlotType::EmptyBits);
+	}
+
+	mSize = 0;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetSize() const
+{
+	return mSize;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetCapacity() const
+{
+	return mMaxSize;
+}
+
+template<class Traits, auto EmptyKey>
+const typename CompactHashTable<Traits, EmptyKey>::AllocatorType& CompactHashTable<Traits, EmptyKey>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Traits, auto EmptyKey>
+float CompactHashTable<Traits, EmptyKey>::GetLoadFactor() const
+{
+	return mCapacity != 0 ? static_cast<float>(mSize) / static_cast<float>(mCapacity) : 0.f;
+}
+
+template<class Traits, auto EmptyKey>
+float CompactHashTable<Traits, EmptyKey>::GetMaxLoadFactor() const
+{
+	return mMaxLoadFactor;
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::SetMaxLoadFactor(float LoadFactor)
+{
+	mMaxLoadFactor = LoadFactor < MinMaxLoadFactor ? MinMaxLoadFactor : LoadFactor > MaxMaxLoadFactor ? MaxMaxLoadFactor : LoadFactor;
+	mMaxSize = GetMaxSize(mCapacity);
+
+	if (mSize > mMaxSize)
+	{
+		RehashElements(GetMinCapacity(mSize));
+	}
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::Rehash(size_t Capacity)
+{
+	if (Capacity < mSize)
+	{
+		Capacity = mSize;
+	}
+
+	if (Capacity == 0)
+	{
+		DeallocateSlots(mSlots);
+
+		mSlots = nullptr;
+		mCapacity = 0;
+		mSlotCount = 0;
+		mMaxSize = 0;
+	}
+	else
+	{
+		size_t NewCapacity = GetMinCapacity(Capacity);
+		if (NewCapacity != mCapacity)
+		{
+			RehashElements(NewCapacity);
+		}
+	}
+}
+
+template<class Traits, auto EmptyKey>
+template<class K>
+size_t CompactHashTable<Traits, EmptyKey>::FindIndex(const K& InKey, size_t Hash) const
+{
+	if (mSize == 0)
+	{
+		return mSlotCount;
+	}
+
+	size_t HomeIndex = GetHomeIndex(Hash);
+
+	// Elements from earlier home slots may be displaced past the home slot of the key. An element from a later home
+	// slot (or an empty slot) means the searched key would've been before it, so the key is not in the table.
+	for (size_t Index = HomeIndex; !IsEmpty(Index); Index++)
+	{
+		if (Traits::IsEqual(Traits::GetKey(mSlots[Index]), InKey))
+		{
+			return Index;
+		}
+
+		if (GetElementHomeIndex(Index) > HomeIndex)
+		{
+			break;
+		}
+	}
+
+	return mSlotCount;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::FindRunEnd(size_t Index) const
+{
+	const KeyType& RunKey = Traits::GetKey(mSlots[Index]);
+
+	// The last slot is always empty, so the loop never reaches the sentinel.
+	size_t Last = Index + 1;
+	while (!IsEmpty(Last) && Traits::IsEqual(Traits::GetKey(mSlots[Last]), RunKey))
+	{
+		Last++;
+	}
+
+	return Last;
+}
+
+template<class Traits, auto EmptyKey>
+Pair<size_t, bool> CompactHashTable<Traits, EmptyKey>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	KW_ASSERT(std::bit_cast<typename SlotType::BitsType>(InKey) != SlotType::EmptyBits, "The empty key can't be inserted.");
+
+	if (mCapacity == 0)
+	{
+		RehashElements(MinCapacity);
+	}
+
+	while (true)
+	{
+		size_t HomeIndex = GetHomeIndex(Hash);
+		size_t Index = HomeIndex;
+
+		while (!IsEmpty(Index))
+		{
+			if (Traits::IsEqual(Traits::GetKey(mSlots[Index]), InKey))
+			{
+				if constexpr (Traits::IsUnique)
+				{
+					return { Index, false };
+				}
+				else
+				{
+					// Insert after the equal keys to keep them contiguous.
+					Index = FindRunEnd(Index);
+					break;
+				}
+			}
+
+			if (GetElementHomeIndex(Index) > HomeIndex)
+			{
+				break;
+			}
+
+			Index++;
+		}
+
+		if (mSize >= mMaxSize)
+		{
+			RehashElements(mCapacity + (mCapacity >> GrowthShift));
+			continue;
+		}
+
+		PrepareInsert(Index);
+		mSize++;
+
+		return { Index, true };
+	}
+}
+
+template<class Traits, auto EmptyKey>
+bool CompactHashTable<Traits, EmptyKey>::IsFull() const
+{
+	return mCapacity != 0 && mSize >= mMaxSize;
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::Prefetch(size_t Hash) const
+{
+	if (mCapacity != 0)
+	{
+		KW_PREFETCH(mSlots + GetHomeIndex(Hash));
+	}
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::EraseIndex(size_t Index)
+{
+	mSlots[Index].~ElementType();
+
+	// Displaced elements that follow move one slot closer to their home slots. An empty slot or an element in its home
+	// slot ends the run.
+	size_t Last = Index + 1;
+	while (!IsEmpty(Last) && GetElementHomeIndex(Last) < Last)
+	{
+		Last++;
+	}
+
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(mSlots + Index, mSlots + Index + 1, sizeof(ElementType) * (Last - Index - 1));
+	}
+	else
+	{
+		for (size_t i = Index + 1; i < Last; i++)
+		{
+			new (mSlots + i - 1) ElementType(Move(mSlots[i]));
+			mSlots[i].~ElementType();
+		}
+	}
+
+	SlotType::SetBits(mSlots + Last - 1, SlotType::EmptyBits);
+	mSize--;
+
+	// The element that followed the erased one was either shifted into its slot or left where it was.
+	return SkipEmpty(Index);
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::EraseRun(size_t Index, size_t Count)
+{
+	for (size_t i = Index; i < Index + Count; i++)
+	{
+		mSlots[i].~ElementType();
+	}
+
+	// Same as `RobinHoodHashTable::EraseRun`: displaced elements that follow move back by up to the length of the run,
+	// but not past their home slots.
+	size_t Free = Index;
+	size_t Last = Index + Count;
+	while (Free < Last && !IsEmpty(Last))
+	{
+		size_t HomeIndex = GetElementHomeIndex(Last);
+		if (HomeIndex == Last)
+		{
+			break;
+		}
+
+		size_t Target = HomeIndex > Free ? HomeIndex : Free;
+
+		for (; Free < Target; Free++)
+		{
+			SlotType::SetBits(mSlots + Free, SlotType::EmptyBits);
+		}
+
+		if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+		{
+			Memory::Memcpy(mSlots + Target, mSlots + Last, sizeof(ElementType));
+		}
+		else
+		{
+			new (mSlots + Target) ElementType(Move(mSlots[Last]));
+			mSlots[Last].~ElementType();
+		}
+
+		Free = Target + 1;
+		Last++;
+	}
+
+	for (; Free < Last; Free++)
+	{
+		SlotType::SetBits(mSlots + Free, SlotType::EmptyBits);
+	}
+
+	mSize -= Count;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::SkipEmpty(size_t Index) const
+{
+	// The sentinel after the last slot stops the loop.
+	while (IsEmpty(Index))
+	{
+		Index++;
+	}
+
+	return Index;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetEndIndex() const
+{
+	return mSlotCount;
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ElementType& CompactHashTable<Traits, EmptyKey>::GetElement(size_t Index)
+{
+	return mSlots[Index];
+}
+
+template<class Traits, auto EmptyKey>
+const typename CompactHashTable<Traits, EmptyKey>::ElementType& CompactHashTable<Traits, EmptyKey>::GetElement(size_t Index) const
+{
+	return mSlots[Index];
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::Iterator CompactHashTable<Traits, EmptyKey>::MakeIterator(size_t Index)
+{
+	return Iterator(mSlots + Index);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ConstIterator CompactHashTable<Traits, EmptyKey>::MakeIterator(size_t Index) const
+{
+	return ConstIterator(mSlots + Index);
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetIndex(ConstIterator Position) const
+{
+	return Position.mElement - mSlots;
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::Iterator CompactHashTable<Traits, EmptyKey>::GetBegin()
+{
+	return Iterator(mSlots != nullptr ? mSlots + SkipEmpty(0) : nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ConstIterator CompactHashTable<Traits, EmptyKey>::GetBegin() const
+{
+	return ConstIterator(mSlots != nullptr ? mSlots + SkipEmpty(0) : nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::Iterator CompactHashTable<Traits, EmptyKey>::GetEnd()
+{
+	return Iterator(mSlots + mSlotCount);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ConstIterator CompactHashTable<Traits, EmptyKey>::GetEnd() const
+{
+	return ConstIterator(mSlots + mSlotCount);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::Iterator CompactHashTable<Traits, EmptyKey>::GetLast()
+{
+	// The sentinel before the first slot stops the decrement of an empty table's end iterator.
+	return mSlots != nullptr ? --GetEnd() : Iterator(nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ConstIterator CompactHashTable<Traits, EmptyKey>::GetLast() const
+{
+	return mSlots != nullptr ? --GetEnd() : ConstIterator(nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::Iterator CompactHashTable<Traits, EmptyKey>::GetBeforeBegin()
+{
+	return Iterator(mSlots != nullptr ? mSlots - 1 : nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ConstIterator CompactHashTable<Traits, EmptyKey>::GetBeforeBegin() const
+{
+	return ConstIterator(mSlots != nullptr ? mSlots - 1 : nullptr);
+}
+
+template<class Traits, auto EmptyKey>
+bool CompactHashTable<Traits, EmptyKey>::IsEmpty(size_t Index) const
+{
+	return SlotType::IsEmpty(mSlots + Index);
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetMaxSize(size_t Capacity) const
+{
+	return static_cast<size_t>(static_cast<double>(Capacity) * mMaxLoadFactor);
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetMinCapacity(size_t Size) const
+{
+	// Any number of home slots works, so round up only to the maximum load factor.
+	size_t Capacity = static_cast<size_t>(static_cast<double>(Size) / mMaxLoadFactor);
+	if (Capacity < MinCapacity)
+	{
+		Capacity = MinCapacity;
+	}
+
+	while (GetMaxSize(Capacity) < Size)
+	{
+		Capacity++;
+	}
+
+	return Capacity;
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetHomeIndex(size_t Hash) const
+{
+	// Fibonacci hashing scaled to the number of home slots. The product is sorted by its top bits, which depend on
+	// all bits of the hash, so even an identity hash of integers spreads evenly.
+	return static_cast<size_t>(HashDetails::MultiplyHigh(static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ULL, mCapacity));
+}
+
+template<class Traits, auto EmptyKey>
+size_t CompactHashTable<Traits, EmptyKey>::GetElementHomeIndex(size_t Index) const
+{
+	return GetHomeIndex(Traits::GetHash(Traits::GetKey(mSlots[Index])));
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::PrepareInsert(size_t Index)
+{
+	size_t EmptyIndex = Index;
+	while (!IsEmpty(EmptyIndex))
+	{
+		EmptyIndex++;
+	}
+
+	// The last slot must stay empty.
+	if (EmptyIndex + 1 == mSlotCount)
+	{
+		ExtendOverflow();
+	}
+
+	// Shift [Index, EmptyIndex) one slot forward. Elements stay sorted by home slot, each one moves away from it.
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(mSlots + Index + 1, mSlots + Index, sizeof(ElementType) * (EmptyIndex - Index));
+	}
+	else
+	{
+		for (size_t i = EmptyIndex; i > Index; i--)
+		{
+			new (mSlots + i) ElementType(Move(mSlots[i - 1]));
+			mSlots[i - 1].~ElementType();
+		}
+	}
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::RehashElements(size_t Capacity)
+{
+	ElementType* OldSlots = mSlots;
+	size_t OldSlotCount = mSlotCount;
+
+	mCapacity = Capacity;
+	mSlotCount = Capacity + (Capacity < MaxOverflow ? Capacity : MaxOverflow);
+	mSlots = AllocateSlots(mSlotCount);
+	mMaxSize = GetMaxSize(Capacity);
+
+	// Old elements are sorted by their old home slots, which grow with the new ones. So most of them are appended to
+	// the end of their runs without shifting, even when the table shrinks.
+	for (size_t i = 0; i < OldSlotCount; i++)
+	{
+		if (!SlotType::IsEmpty(OldSlots + i))
+		{
+			size_t HomeIndex = GetHomeIndex(Traits::GetHash(Traits::GetKey(OldSlots[i])));
+			size_t Index = HomeIndex;
+
+			while (!IsEmpty(Index) && GetElementHomeIndex(Index) <= HomeIndex)
+			{
+				Index++;
+			}
+
+			PrepareInsert(Index);
+
+			new (mSlots + Index) ElementType(Move(OldSlots[i]));
+			OldSlots[i].~ElementType();
+		}
+	}
+
+	DeallocateSlots(OldSlots);
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::ExtendOverflow()
+{
+	ElementType* OldSlots = mSlots;
+	size_t OldSlotCount = mSlotCount;
+
+	// Only happens with long runs near the end of the table, e.g. when many keys have the same hash.
+	mSlotCount += mSlotCount - mCapacity;
+	mSlots = AllocateSlots(mSlotCount);
+
+	for (size_t i = 0; i < OldSlotCount; i++)
+	{
+		if (!SlotType::IsEmpty(OldSlots + i))
+		{
+			new (mSlots + i) ElementType(Move(OldSlots[i]));
+			OldSlots[i].~ElementType();
+		}
+	}
+
+	DeallocateSlots(OldSlots);
+}
+
+template<class Traits, auto EmptyKey>
+template<class OtherTable>
+void CompactHashTable<Traits, EmptyKey>::CopyElements(const OtherTable& Other)
+{
+	mMaxLoadFactor = Other.mMaxLoadFactor;
+
+	if (Other.mSize > 0)
+	{
+		// Same hash and the same number of home slots give the same layout, so no rehashing is needed.
+		mCapacity = Other.mCapacity;
+		mMaxSize = Other.mMaxSize;
+		mSlotCount = Other.mSlotCount;
+		mSlots = AllocateSlots(mSlotCount);
+
+		if constexpr (TypeTraits::IsTriviallyCopyable<ElementType>)
+		{
+			Memory::Memcpy(mSlots, Other.mSlots, sizeof(ElementType) * mSlotCount);
+		}
+		else
+		{
+			for (size_t i = 0; i < mSlotCount; i++)
+			{
+				if (!SlotType::IsEmpty(Other.mSlots + i))
+				{
+					new (mSlots + i) ElementType(Other.mSlots[i]);
+				}
+			}
+		}
+
+		mSize = Other.mSize;
+	}
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::DestroyElements()
+{
+	if constexpr (!TypeTraits::IsTriviallyDestructible<ElementType>)
+	{
+		for (size_t i = 0; i < mSlotCount; i++)
+		{
+			if (!IsEmpty(i))
+			{
+				mSlots[i].~ElementType();
+			}
+		}
+	}
+}
+
+template<class Traits, auto EmptyKey>
+typename CompactHashTable<Traits, EmptyKey>::ElementType* CompactHashTable<Traits, EmptyKey>::AllocateSlots(size_t SlotCount)
+{
+	ElementType* Slots = ElementAllocator(GetAllocator()).Allocate(SlotCount + 2) + 1;
+
+	SlotType::SetBits(Slots - 1, SlotType::SentinelBits);
+	for (size_t i = 0; i < SlotCount; i++)
+	{
+		SlotType::SetBits(Slots + i, SlotType::EmptyBits);
+	}
+	SlotType::SetBits(Slots + SlotCount, SlotType::SentinelBits);
+
+	return Slots;
+}
+
+template<class Traits, auto EmptyKey>
+void CompactHashTable<Traits, EmptyKey>::DeallocateSlots(ElementType* Slots)
+{
+	if (Slots != nullptr)
+	{
+		ElementAllocator(GetAllocator()).Deallocate(Slots - 1);
+	}
+}
+
+} // namespace kw
@@ -2,6 +2,7 @@
 
 #include "ContainerUtils.h"
 
+#include <compare>
 #include <concepts>
 
 namespace kw {
@@ -74,13 +75,51 @@ concept EqualityComparable = std::equality_comparable<T>;
 template<class T, class U>
 concept EqualityComparableWith = std::equality_comparable_with<T, U>;
 
+// Specifies whether objects of the given types T and U can be compared with operator<=> and the other comparison operators.
+template<class T, class U>
+concept ThreeWayComparableWith = std::three_way_comparable_with<T, U>;
+
 // Specifies whether the given callable type can be invoked with the specified set of argument types.
 template<class F, class... Args>
 concept Invocable = std::invocable<F, Args...>;
 
-// Specifies whether the given types are the same with possibly different const specifier.
+// Specifies whether the given hash or comparison functor type accepts keys of other types than the one it's declared
+// for, e.g. string views for strings. Such functors declare an `IsTransparent` member type.
+template<class F>
+concept Transparent = requires
+{
+	typename F::IsTransparent;
+};
+
+// Specifies whether the given types are the same with possibly different const specifier. References are compared by
+// the referred type, so `const T&` is the same as `T&`.
 template<class T, class U>
-concept SameAsConstless = std::same_as<std::remove_const_t<T>, std::remove_const_t<U>>;
+concept SameAsConstless = std::same_as<std::remove_const_t<std::remove_reference_t<T>>, std::remove_const_t<std::remove_reference_t<U>>>;
+
+// Specifies whether the given allocator type can try to grow an allocation of elements of the specified type T in-place.
+// `TryExpand(Address, OldCount, NewCount)` must return false and leave the allocation intact when it's not possible.
+template<class Allocator, class T>
+concept ExpandableAllocator = requires(Allocator& Value, T* Address, size_t Count)
+{
+    { Value.TryExpand(Address, Count, Count) } -> SameAs<bool>;
+};
+
+// Specifies whether the given allocator type can resize an allocation of elements of the specified type T.
+// `Reallocate(Address, OldCount, NewCount)` may move the bytes to another address, so it's only usable for trivially
+// relocatable types. Null address must be handled like `Allocate(NewCount)`.
+template<class Allocator, class T>
+concept ReallocatableAllocator = requires(Allocator& Value, T* Address, size_t Count)
+{
+    { Value.Reallocate(Address, Count, Count) } -> SameAs<T*>;
+};
+
+// Specifies whether the given allocator type can tell how many elements of the specified type T actually fit into
+// the block it allocates for `GetUsableCount(Count)` elements. The result must be equal or greater than `Count`.
+template<class Allocator, class T>
+concept SizeClassAwareAllocator = requires(const Allocator& Value, size_t Count)
+{
+    { Value.GetUsableCount(Count) } -> SameAs<size_t>;
+};
 
 // Specifies whether the given type T is an iterator type over a range of elements of the specified type U.
 template<class T, class U>
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "HashMap.h"
+#include "HashTraits.h"
+#include "MallocAllocator.h"
+#include "Pair.h"
+#include "Utility.h"
+
+#include <bit>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+
+namespace kw
+{
+
+// A hash map that many threads can access at once. Elements are distributed over shards by their hashes, and each
+// shard is a `HashMap` with its own reader-writer lock, so threads that access different shards never wait for each
+// other, and lookups in the same shard run in parallel. Iterators and references to elements are never returned,
+// since other threads may move or erase the elements as soon as the lock is released. Values are copied out instead,
+// or accessed by a callback under the lock.
+template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>, class Layout = RobinHoodHashLayout>
+class ConcurrentHashMap
+{
+public:
+	using MapType = HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>;
+	using KeyType = Key;
+	using ValueType = Value;
+	using ElementType = typename MapType::ElementType;
+	using AllocatorType = Allocator;
+
+	// Constructs an empty map with the given number of shards, rounded up to a power of two. With several times more
+	// shards than threads, two threads rarely need the same shard at once.
+	explicit ConcurrentHashMap(size_t ShardCount = DefaultShardCount, const Allocator& InAllocator = Allocator());
+
+	ConcurrentHashMap(const ConcurrentHashMap& Other) = delete;
+	ConcurrentHashMap& operator=(const ConcurrentHashMap& Other) = delete;
+
+	// Destroys the map. No other thread may access it anymore.
+	~ConcurrentHashMap();
+
+	// Allocate at least the given number of elements in the map, split evenly between the shards.
+	void Reserve(size_t Capacity);
+
+	// Clear the map. Shards are cleared one after another, so elements that other threads insert meanwhile may stay.
+	void Clear();
+
+	// If an element with the given key exists, copy its value to the given result and return true. Otherwise return
+	// false and leave the result unchanged.
+	bool Find(const KeyType& InKey, ValueType& Result) const;
+
+	// Return whether an element with the given key exists in the map.
+	bool Contains(const KeyType& InKey) const;
+
+	// Insert an element with the given key and value, or assign the given value to the element with the given key if
+	// it exists. Return true if the element was inserted.
+	bool InsertOrAssign(const KeyType& InKey, const ValueType& InValue);
+	bool InsertOrAssign(const KeyType& InKey, ValueType&& InValue);
+
+	// Remove the element with the given key from the map. Return whether it existed.
+	bool Erase(const KeyType& InKey);
+
+	// Call the given function with a reference to the value of the element with the given key, while no other thread
+	// can access its shard. Return false if there's no element with the given key. Useful for read-modify-write
+	// updates, e.g. incrementing a counter. The function must not access the map.
+	template<class Function>
+	bool Update(const KeyType& InKey, Function&& Callback);
+
+	// Call the given function with each element of the map. Each shard is visited while other threads can only read
+	// it, so the visited elements are not a snapshot of the whole map. The function must not access the map.
+	template<class Function>
+	void ForEach(Function&& Callback) const;
+
+	// Return how many elements are stored in the map. Other threads may change the number by the time it's returned.
+	size_t GetSize() const;
+
+	// Return the number of shards.
+	size_t GetShardCount() const;
+
+private:
+	static constexpr size_t DefaultShardCount = 64;
+
+	// Shards are aligned to cache lines, so locking one shard doesn't invalidate the cached lock of its neighbour.
+	struct alignas(64) Shard
+	{
+		Shard(const Allocator& InAllocator);
+
+		mutable std::shared_mutex Mutex;
+		MapType Map;
+	};
+
+	using ShardAllocator = typename HashDetails::RebindAllocator<Allocator, Shard>::Type;
+
+	// Return the shard of the element with the given hash.
+	Shard& GetShard(size_t Hash) const;
+
+	ShardAllocator mShardAllocator;
+	Shard* mShards;
+	size_t mShardMask;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Shard::Shard(const Allocator& InAllocator)
+	: Map(InAllocator)
+{
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ConcurrentHashMap(size_t ShardCount, const Allocator& InAllocator)
+	: mShardAllocator(InAllocator)
+	, mShards(nullptr)
+	, mShardMask(std::bit_ceil(ShardCount != 0 ? ShardCount : 1) - 1)
+{
+	mShards = mShardAllocator.Allocate(mShardMask + 1);
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		new (&mShards[i]) Shard(InAllocator);
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::~ConcurrentHashMap()
+{
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		mShards[i].~Shard();
+	}
+
+	mShardAllocator.Deallocate(mShards);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reserve(size_t Capacity)
+{
+	// Shards don't get exactly the same number of elements, but each of them can still grow on its own.
+	size_t ShardCapacity = (Capacity + mShardMask) / (mShardMask + 1);
+
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		std::unique_lock Lock(mShards[i].Mutex);
+		mShards[i].Map.Reserve(ShardCapacity);
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Clear()
+{
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		std::unique_lock Lock(mShards[i].Mutex);
+		mShards[i].Map.Clear();
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Find(const KeyType& InKey, ValueType& Result) const
+{
+	// The key is hashed before the lock is taken, and the shard's table reuses the hash.
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	std::shared_lock Lock(KeyShard.Mutex);
+
+	typename MapType::Iterator It = KeyShard.Map.FindWithHash(InKey, Hash);
+	if (It == KeyShard.Map.GetEnd())
+	{
+		return false;
+	}
+
+	Result = It->Value;
+	return true;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Contains(const KeyType& InKey) const
+{
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	std::shared_lock Lock(KeyShard.Mutex);
+	return KeyShard.Map.FindWithHash(InKey, Hash) != KeyShard.Map.GetEnd();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::InsertOrAssign(const KeyType& InKey, const ValueType& InValue)
+{
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	// The shard is probed once under the lock.
+	std::unique_lock Lock(KeyShard.Mutex);
+	return KeyShard.Map.InsertOrAssignWithHash(InKey, InValue, Hash).Value;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::InsertOrAssign(const KeyType& InKey, ValueType&& InValue)
+{
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	// The shard is probed once under the lock.
+	std::unique_lock Lock(KeyShard.Mutex);
+	return KeyShard.Map.InsertOrAssignWithHash(InKey, Move(InValue), Hash).Value;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Erase(const KeyType& InKey)
+{
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	std::unique_lock Lock(KeyShard.Mutex);
+	return KeyShard.Map.EraseWithHash(InKey, Hash) != 0;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+template<class Function>
+bool ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Update(const KeyType& InKey, Function&& Callback)
+{
+	size_t Hash = MapType::GetHash(InKey);
+	Shard& KeyShard = GetShard(Hash);
+
+	std::unique_lock Lock(KeyShard.Mutex);
+
+	typename MapType::Iterator It = KeyShard.Map.FindWithHash(InKey, Hash);
+	if (It == KeyShard.Map.GetEnd())
+	{
+		return false;
+	}
+
+	Callback(It->Value);
+	return true;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+template<class Function>
+void ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ForEach(Function&& Callback) const
+{
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		std::shared_lock Lock(mShards[i].Mutex);
+
+		const MapType& ShardMap = mShards[i].Map;
+		for (typename MapType::ConstIterator It = ShardMap.GetBegin(); It != ShardMap.GetEnd(); ++It)
+		{
+			Callback(*It);
+		}
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+size_t ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::GetSize() const
+{
+	size_t Size = 0;
+	for (size_t i = 0; i <= mShardMask; i++)
+	{
+		std::shared_lock Lock(mShards[i].Mutex);
+		Size += mShards[i].Map.GetSize();
+	}
+	return Size;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+size_t ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::GetShardCount() const
+{
+	return mShardMask + 1;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Shard& ConcurrentHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::GetShard(size_t Hash) const
+{
+	// Tables take home slots from the top bits of the hash multiplied by the Fibonacci constant. Shards are picked by
+	// a different mix of the hash, so those bits stay uniform within each shard.
+	return mShards[static_cast<size_t>(HashDetails::MultiplyMix(Hash, 0xD6E8FEB86659FD93ULL)) & mShardMask];
+}
+
+} // namespace kw
@@ -5,7 +5,7 @@ namespace kw::ContainerUtils
 
 // Return an iterator to the beginning of the given container, view, or array.
 template<class T>
-auto GetBegin(T& Container)
+auto GetBegin(T& Container) -> decltype(Container.begin())
 {
 	// Lowercase method call to support initializer list.
 	return Container.begin();
@@ -13,7 +13,7 @@ auto GetBegin(T& Container)
 
 // Return an iterator to the end of the given container, view, or array.
 template<class T>
-auto GetEnd(T& Container)
+auto GetEnd(T& Container) -> decltype(Container.end())
 {
 	// Lowercase method call to support initializer list.
 	return Container.end();
@@ -21,7 +21,7 @@ auto GetEnd(T& Container)
 
 // Return size of the given container, view, or array.
 template<class T>
-auto GetSize(T& Container)
+auto GetSize(T& Container) -> decltype(Container.size())
 {
 	// Lowercase method call to support initializer list.
 	return Container.size();
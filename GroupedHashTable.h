@@ -0,0 +1,867 @@
+#pragma once
+
+#include "Assert.h"
+#include "Concepts.h"
+#include "HashTraits.h"
+#include "Memory.h"
+#include "Pair.h"
+#include "SwissHashTable.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <cstdint>
+#include <new>
+
+namespace kw
+{
+
+template<class Traits, class Layout>
+class GroupedHashTable;
+
+namespace HashDetails
+{
+
+// Elements with equal keys in `GroupedHashTable`. A single element is stored inline. When more elements join it, they
+// move to an array that the table allocates and owns, so destroying a group only destroys the inline element, and a
+// copy of a group shares the array until the table replaces it with a copy.
+template<class T>
+struct HashGroup
+{
+	// Constructs a group of one inline element. The caller constructs the element.
+	HashGroup();
+	HashGroup(const HashGroup& Other);
+	HashGroup(HashGroup&& Other);
+	~HashGroup();
+
+	T* GetElements();
+	const T* GetElements() const;
+
+	union
+	{
+		T Inline;
+		T* Elements;
+	};
+
+	uint32_t Size;
+
+	// Zero while the only element is stored inline.
+	uint32_t Capacity;
+};
+
+// Traits of the probing table of `GroupedHashTable`, which stores a group per distinct key instead of the elements.
+template<class Traits>
+struct GroupedHashTraits
+{
+	using KeyType = typename Traits::KeyType;
+	using ElementType = HashGroup<typename Traits::ElementType>;
+	using ElementHashType = typename Traits::ElementHashType;
+	using ElementEqualType = typename Traits::ElementEqualType;
+	using AllocatorType = typename RebindAllocator<typename Traits::AllocatorType, ElementType>::Type;
+
+	static constexpr bool IsUnique = true;
+	static constexpr bool IsTransparent = Traits::IsTransparent;
+
+	static const KeyType& GetKey(const ElementType& Element);
+
+	template<class K>
+	static size_t GetHash(const K& InKey);
+
+	template<class K>
+	static bool IsEqual(const KeyType& Lhs, const K& Rhs);
+};
+
+} // namespace HashDetails
+
+namespace TypeTraits
+{
+
+// Groups hold either the inline element or a pointer to the array.
+template<class T>
+struct TriviallyRelocatable<HashDetails::HashGroup<T>> : BoolConstant<IsTriviallyRelocatable<T>> {};
+
+} // namespace TypeTraits
+
+// Bidirectional iterator over elements of `GroupedHashTable`. Iterates over the elements of a group, then moves to the
+// next group of the probing table.
+template<class T, class InnerIterator, class MutableInnerIterator>
+class GroupedHashIterator
+{
+public:
+	using ValueType = T;
+
+	GroupedHashIterator() = default;
+	GroupedHashIterator(InnerIterator InPosition, size_t InIndex, InnerIterator InBeforeBegin);
+	GroupedHashIterator(const GroupedHashIterator<TypeTraits::RemoveConst<T>, MutableInnerIterator, MutableInnerIterator>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	GroupedHashIterator& operator++();
+	GroupedHashIterator operator++(int);
+
+	GroupedHashIterator& operator--();
+	GroupedHashIterator operator--(int);
+
+	friend bool operator==(const GroupedHashIterator& Lhs, const GroupedHashIterator& Rhs)
+	{
+		return Lhs.mPosition == Rhs.mPosition && Lhs.mIndex == Rhs.mIndex;
+	}
+
+private:
+	template<class U, class V, class W>
+	friend class GroupedHashIterator;
+
+	template<class Traits, class Layout>
+	friend class GroupedHashTable;
+
+	// Position of the group in the probing table.
+	InnerIterator mPosition;
+
+	// The sentinel before the first group has no size to read, so the iterator must recognize it.
+	InnerIterator mBeforeBegin;
+
+	// Index of the element in the group.
+	size_t mIndex;
+};
+
+// Hash table for multi key containers that stores every distinct key once. The probing table of `Layout` holds a group
+// per key: either its only element inline, or a pointer to an array of all the elements with the key, in insertion
+// order. A heavily duplicated key takes a single slot, so it doesn't lengthen the probe sequences of other keys, an
+// insertion of a duplicate appends to the array instead of shifting the following slots, and `Count`, `FindRange`, and
+// `Erase` of a key cost O(1 + matches). Capacity and load factor count distinct keys. Arrays are allocated with the
+// container's allocator and grow geometrically. `Layout` must be either `RobinHoodHashLayout` or `SwissHashLayout`.
+// See `HashBase` for the interface.
+template<class Traits, class Layout>
+class GroupedHashTable : protected Traits::AllocatorType
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	using InnerTraits = HashDetails::GroupedHashTraits<Traits>;
+	using InnerTable = typename Layout::template Table<InnerTraits>;
+	using GroupType = HashDetails::HashGroup<ElementType>;
+
+	using Iterator = GroupedHashIterator<ElementType, typename InnerTable::Iterator, typename InnerTable::Iterator>;
+	using ConstIterator = GroupedHashIterator<const ElementType, typename InnerTable::ConstIterator, typename InnerTable::Iterator>;
+
+	explicit GroupedHashTable(const AllocatorType& InAllocator);
+	GroupedHashTable(const GroupedHashTable& Other);
+	GroupedHashTable(GroupedHashTable&& Other);
+	~GroupedHashTable();
+
+	template<class OtherTraits>
+	GroupedHashTable(const GroupedHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator);
+
+	GroupedHashTable& operator=(const GroupedHashTable& Other);
+	GroupedHashTable& operator=(GroupedHashTable&& Other);
+
+	// Reserve the probing table for the given number of distinct keys.
+	void Reserve(size_t Capacity);
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+
+	// Only the probing table is reallocated, which never has fewer slots than there are distinct keys.
+	void Rehash(size_t Capacity);
+
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+	size_t FindRunEnd(size_t Index) const;
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+	bool IsFull() const;
+	void Prefetch(size_t Hash) const;
+
+	// Keeps the order of the remaining elements of the group, so iteration with erasure visits every element once.
+	size_t EraseIndex(size_t Index);
+
+	// The run is always a whole group.
+	void EraseRun(size_t Index, size_t Count);
+
+	size_t SkipEmpty(size_t Index) const;
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits, class OtherLayout>
+	friend class GroupedHashTable;
+
+	// Indices of elements keep the slot of their group in the upper bits and the index in the group in the lower bits,
+	// so the elements of a group have consecutive indices. Both halves take 32 bits, so tables have fewer than 2^32
+	// slots, and groups have fewer than 2^32 elements.
+	static_assert(sizeof(size_t) == 8, "Grouped hash tables require 64-bit indices.");
+
+	static constexpr size_t SlotShift = 32;
+	static constexpr size_t ElementMask = (static_cast<size_t>(1) << SlotShift) - 1;
+	static constexpr size_t MaxSlotCount = static_cast<size_t>(1) << (64 - SlotShift);
+
+	// Capacity of the array that a group allocates when its second element is inserted.
+	static constexpr uint32_t MinGroupCapacity = 4;
+
+	// Make room for one more element in the given group.
+	void GrowGroup(GroupType& Group);
+
+	// Erase the group in the given slot with all its elements. Return the index of the first element of the next group.
+	size_t EraseGroup(size_t Slot);
+
+	// Replace the arrays that groups share with the copied table with copies of them.
+	void CopyArrays();
+
+	// Destroy the elements stored in arrays and deallocate the arrays. Inline elements are destroyed with the groups.
+	void DestroyArrays();
+
+	InnerTable mTable;
+
+	// Number of elements in all groups.
+	size_t mSize;
+};
+
+// Layout of multi key containers that uses `GroupedHashTable` on top of the given layout. The default one for
+// `HashMultiMap` and `HashMultiSet`, use plain layouts when most keys are unique.
+template<class Layout = SwissHashLayout>
+struct GroupedHashLayout
+{
+	template<class Traits>
+	using Table = GroupedHashTable<Traits, Layout>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace HashDetails
+{
+
+template<class T>
+HashGroup<T>::HashGroup()
+	: Size(1)
+	, Capacity(0)
+{
+}
+
+template<class T>
+HashGroup<T>::HashGroup(const HashGroup& Other)
+	: Size(Other.Size)
+	, Capacity(Other.Capacity)
+{
+	if (Capacity == 0)
+	{
+		new (&Inline) T(Other.Inline);
+	}
+	else
+	{
+		Elements = Other.Elements;
+	}
+}
+
+template<class T>
+HashGroup<T>::HashGroup(HashGroup&& Other)
+	: Size(Other.Size)
+	, Capacity(Other.Capacity)
+{
+	if (Capacity == 0)
+	{
+		new (&Inline) T(Move(Other.Inline));
+	}
+	else
+	{
+		Elements = Other.Elements;
+	}
+}
+
+template<class T>
+HashGroup<T>::~HashGroup()
+{
+	if (Capacity == 0)
+	{
+		Inline.~T();
+	}
+}
+
+template<class T>
+T* HashGroup<T>::GetElements()
+{
+	return Capacity != 0 ? Elements : &Inline;
+}
+
+template<class T>
+const T* HashGroup<T>::GetElements() const
+{
+	return Capacity != 0 ? Elements : &Inline;
+}
+
+template<class Traits>
+const typename GroupedHashTraits<Traits>::KeyType& GroupedHashTraits<Traits>::GetKey(const ElementType& Element)
+{
+	return Traits::GetKey(*Element.GetElements());
+}
+
+template<class Traits>
+template<class K>
+size_t GroupedHashTraits<Traits>::GetHash(const K& InKey)
+{
+	return Traits::GetHash(InKey);
+}
+
+template<class Traits>
+template<class K>
+bool GroupedHashTraits<Traits>::IsEqual(const KeyType& Lhs, const K& Rhs)
+{
+	return Traits::IsEqual(Lhs, Rhs);
+}
+
+} // namespace HashDetails
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::GroupedHashIterator(InnerIterator InPosition, size_t InIndex, InnerIterator InBeforeBegin)
+	: mPosition(InPosition)
+	, mBeforeBegin(InBeforeBegin)
+	, mIndex(InIndex)
+{
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::GroupedHashIterator(const GroupedHashIterator<TypeTraits::RemoveConst<T>, MutableInnerIterator, MutableInnerIterator>& Other)
+	: mPosition(Other.mPosition)
+	, mBeforeBegin(Other.mBeforeBegin)
+	, mIndex(Other.mIndex)
+{
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+typename GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::ValueType& GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator*() const
+{
+	return mPosition->GetElements()[mIndex];
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+typename GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::ValueType* GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator->() const
+{
+	return mPosition->GetElements() + mIndex;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator>& GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator++()
+{
+	if (mPosition == mBeforeBegin || ++mIndex == mPosition->Size)
+	{
+		++mPosition;
+		mIndex = 0;
+	}
+	return *this;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator> GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator++(int)
+{
+	GroupedHashIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator>& GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator--()
+{
+	if (mIndex == 0)
+	{
+		--mPosition;
+		mIndex = mPosition != mBeforeBegin ? mPosition->Size - 1 : 0;
+	}
+	else
+	{
+		mIndex--;
+	}
+	return *this;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+GroupedHashIterator<T, InnerIterator, MutableInnerIterator> GroupedHashIterator<T, InnerIterator, MutableInnerIterator>::operator--(int)
+{
+	GroupedHashIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>::GroupedHashTable(const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mTable(typename InnerTraits::AllocatorType(InAllocator))
+	, mSize(0)
+{
+}
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>::GroupedHashTable(const GroupedHashTable& Other)
+	: AllocatorType(Other.GetAllocator())
+	, mTable(Other.mTable)
+	, mSize(Other.mSize)
+{
+	CopyArrays();
+}
+
+template<class Traits, class Layout>
+template<class OtherTraits>
+GroupedHashTable<Traits, Layout>::GroupedHashTable(const GroupedHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mTable(Other.mTable, typename InnerTraits::AllocatorType(InAllocator))
+	, mSize(Other.mSize)
+{
+	CopyArrays();
+}
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>::GroupedHashTable(GroupedHashTable&& Other)
+	: AllocatorType(static_cast<AllocatorType&&>(Other))
+	, mTable(static_cast<InnerTable&&>(Other.mTable))
+	, mSize(Other.mSize)
+{
+	Other.mSize = 0;
+}
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>::~GroupedHashTable()
+{
+	DestroyArrays();
+}
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>& GroupedHashTable<Traits, Layout>::operator=(const GroupedHashTable& Other)
+{
+	if (this != &Other)
+	{
+		DestroyArrays();
+
+		mTable = Other.mTable;
+		mSize = Other.mSize;
+
+		CopyArrays();
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+GroupedHashTable<Traits, Layout>& GroupedHashTable<Traits, Layout>::operator=(GroupedHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		DestroyArrays();
+
+		static_cast<AllocatorType&>(*this) = static_cast<AllocatorType&&>(Other);
+
+		mTable = static_cast<InnerTable&&>(Other.mTable);
+		mSize = Other.mSize;
+
+		Other.mSize = 0;
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::Reserve(size_t Capacity)
+{
+	mTable.Reserve(Capacity);
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::Clear()
+{
+	DestroyArrays();
+	mTable.Clear();
+	mSize = 0;
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::GetSize() const
+{
+	return mSize;
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::GetCapacity() const
+{
+	return mTable.GetCapacity();
+}
+
+template<class Traits, class Layout>
+const typename GroupedHashTable<Traits, Layout>::AllocatorType& GroupedHashTable<Traits, Layout>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Traits, class Layout>
+float GroupedHashTable<Traits, Layout>::GetLoadFactor() const
+{
+	return mTable.GetLoadFactor();
+}
+
+template<class Traits, class Layout>
+float GroupedHashTable<Traits, Layout>::GetMaxLoadFactor() const
+{
+	return mTable.GetMaxLoadFactor();
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::SetMaxLoadFactor(float LoadFactor)
+{
+	mTable.SetMaxLoadFactor(LoadFactor);
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::Rehash(size_t Capacity)
+{
+	mTable.Rehash(Capacity);
+}
+
+template<class Traits, class Layout>
+template<class K>
+size_t GroupedHashTable<Traits, Layout>::FindIndex(const K& InKey, size_t Hash) const
+{
+	// The end slot maps to the end index.
+	return mTable.FindIndex(InKey, Hash) << SlotShift;
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::FindRunEnd(size_t Index) const
+{
+	return (Index & ~ElementMask) + mTable.GetElement(Index >> SlotShift).Size;
+}
+
+template<class Traits, class Layout>
+Pair<size_t, bool> GroupedHashTable<Traits, Layout>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	Pair<size_t, bool> Result = mTable.FindOrPrepareInsert(InKey, Hash);
+	KW_ASSERT(mTable.GetEndIndex() < MaxSlotCount, "Too many slots for grouped hash table indices.");
+
+	if (Result.Value)
+	{
+		new (&mTable.GetElement(Result.Key)) GroupType();
+		mSize++;
+
+		return { Result.Key << SlotShift, true };
+	}
+
+	if constexpr (Traits::IsUnique)
+	{
+		return { Result.Key << SlotShift, false };
+	}
+	else
+	{
+		GroupType& Group = mTable.GetElement(Result.Key);
+		KW_ASSERT(Group.Size < ElementMask, "Too many elements with the same key.");
+
+		if (Group.Size >= Group.Capacity)
+		{
+			GrowGroup(Group);
+		}
+		mSize++;
+
+		return { (Result.Key << SlotShift) + Group.Size++, true };
+	}
+}
+
+template<class Traits, class Layout>
+bool GroupedHashTable<Traits, Layout>::IsFull() const
+{
+	return mTable.IsFull();
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::Prefetch(size_t Hash) const
+{
+	mTable.Prefetch(Hash);
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::EraseIndex(size_t Index)
+{
+	size_t Slot = Index >> SlotShift;
+	size_t Position = Index & ElementMask;
+
+	GroupType& Group = mTable.GetElement(Slot);
+	if (Group.Size == 1)
+	{
+		return EraseGroup(Slot);
+	}
+
+	// Groups of several elements are always stored in arrays.
+	ElementType* Elements = Group.Elements;
+	Elements[Position].~ElementType();
+
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(Elements + Position, Elements + Position + 1, sizeof(ElementType) * (Group.Size - Position - 1));
+	}
+	else
+	{
+		for (size_t i = Position + 1; i < Group.Size; i++)
+		{
+			new (Elements + i - 1) ElementType(Move(Elements[i]));
+			Elements[i].~ElementType();
+		}
+	}
+
+	Group.Size--;
+	mSize--;
+
+	return SkipEmpty(Index);
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::EraseRun(size_t Index, size_t Count)
+{
+	KW_ASSERT((Index & ElementMask) == 0 && Count == mTable.GetElement(Index >> SlotShift).Size, "Invalid run.");
+
+	EraseGroup(Index >> SlotShift);
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::SkipEmpty(size_t Index) const
+{
+	size_t Slot = Index >> SlotShift;
+	size_t Position = Index & ElementMask;
+
+	// Only the first index of a slot may belong to an empty slot.
+	if (Position == 0)
+	{
+		return mTable.SkipEmpty(Slot) << SlotShift;
+	}
+
+	if (Position < mTable.GetElement(Slot).Size)
+	{
+		return Index;
+	}
+
+	return mTable.SkipEmpty(Slot + 1) << SlotShift;
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::GetEndIndex() const
+{
+	return mTable.GetEndIndex() << SlotShift;
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ElementType& GroupedHashTable<Traits, Layout>::GetElement(size_t Index)
+{
+	return mTable.GetElement(Index >> SlotShift).GetElements()[Index & ElementMask];
+}
+
+template<class Traits, class Layout>
+const typename GroupedHashTable<Traits, Layout>::ElementType& GroupedHashTable<Traits, Layout>::GetElement(size_t Index) const
+{
+	return mTable.GetElement(Index >> SlotShift).GetElements()[Index & ElementMask];
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::Iterator GroupedHashTable<Traits, Layout>::MakeIterator(size_t Index)
+{
+	return Iterator(mTable.MakeIterator(Index >> SlotShift), Index & ElementMask, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ConstIterator GroupedHashTable<Traits, Layout>::MakeIterator(size_t Index) const
+{
+	return ConstIterator(mTable.MakeIterator(Index >> SlotShift), Index & ElementMask, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::GetIndex(ConstIterator Position) const
+{
+	return (mTable.GetIndex(Position.mPosition) << SlotShift) + Position.mIndex;
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::Iterator GroupedHashTable<Traits, Layout>::GetBegin()
+{
+	return Iterator(mTable.GetBegin(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ConstIterator GroupedHashTable<Traits, Layout>::GetBegin() const
+{
+	return ConstIterator(mTable.GetBegin(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::Iterator GroupedHashTable<Traits, Layout>::GetEnd()
+{
+	return Iterator(mTable.GetEnd(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ConstIterator GroupedHashTable<Traits, Layout>::GetEnd() const
+{
+	return ConstIterator(mTable.GetEnd(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::Iterator GroupedHashTable<Traits, Layout>::GetLast()
+{
+	// The last group of an empty table is the sentinel before the first one.
+	typename InnerTable::Iterator Last = mTable.GetLast();
+	typename InnerTable::Iterator BeforeBegin = mTable.GetBeforeBegin();
+	return Iterator(Last, Last != BeforeBegin ? Last->Size - 1 : 0, BeforeBegin);
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ConstIterator GroupedHashTable<Traits, Layout>::GetLast() const
+{
+	typename InnerTable::ConstIterator Last = mTable.GetLast();
+	typename InnerTable::ConstIterator BeforeBegin = mTable.GetBeforeBegin();
+	return ConstIterator(Last, Last != BeforeBegin ? Last->Size - 1 : 0, BeforeBegin);
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::Iterator GroupedHashTable<Traits, Layout>::GetBeforeBegin()
+{
+	return Iterator(mTable.GetBeforeBegin(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename GroupedHashTable<Traits, Layout>::ConstIterator GroupedHashTable<Traits, Layout>::GetBeforeBegin() const
+{
+	return ConstIterator(mTable.GetBeforeBegin(), 0, mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::GrowGroup(GroupType& Group)
+{
+	// Doubling the largest capacities would overflow, but groups never get more elements than `ElementMask` anyway.
+	uint32_t NewCapacity = Group.Capacity == 0 ? MinGroupCapacity : Group.Capacity > ElementMask / 2 ? static_cast<uint32_t>(ElementMask) : Group.Capacity * 2;
+
+	if (Group.Capacity == 0)
+	{
+		ElementType* Elements = AllocatorType::Allocate(NewCapacity);
+		new (Elements) ElementType(Move(Group.Inline));
+		Group.Inline.~ElementType();
+		Group.Elements = Elements;
+	}
+	else if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType> && ReallocatableAllocator<AllocatorType, ElementType>)
+	{
+		Group.Elements = AllocatorType::Reallocate(Group.Elements, Group.Capacity, NewCapacity);
+	}
+	else
+	{
+		ElementType* Elements = AllocatorType::Allocate(NewCapacity);
+
+		if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+		{
+			Memory::Memcpy(Elements, Group.Elements, sizeof(ElementType) * Group.Size);
+		}
+		else
+		{
+			for (size_t i = 0; i < Group.Size; i++)
+			{
+				new (Elements + i) ElementType(Move(Group.Elements[i]));
+				Group.Elements[i].~ElementType();
+			}
+		}
+
+		AllocatorType::Deallocate(Group.Elements);
+		Group.Elements = Elements;
+	}
+
+	Group.Capacity = NewCapacity;
+}
+
+template<class Traits, class Layout>
+size_t GroupedHashTable<Traits, Layout>::EraseGroup(size_t Slot)
+{
+	GroupType& Group = mTable.GetElement(Slot);
+	ElementType* Elements = Group.Capacity != 0 ? Group.Elements : nullptr;
+	size_t Size = Group.Size;
+
+	// The probing table may read the key of the erased group, so the array outlives it. Destruction of the group
+	// destroys an inline element.
+	size_t NextSlot = mTable.EraseIndex(Slot);
+
+	if (Elements != nullptr)
+	{
+		for (size_t i = 0; i < Size; i++)
+		{
+			Elements[i].~ElementType();
+		}
+		AllocatorType::Deallocate(Elements);
+	}
+
+	mSize -= Size;
+
+	return NextSlot << SlotShift;
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::CopyArrays()
+{
+	if (mTable.GetSize() == 0)
+	{
+		return;
+	}
+
+	for (size_t i = mTable.SkipEmpty(0); i != mTable.GetEndIndex(); i = mTable.SkipEmpty(i + 1))
+	{
+		GroupType& Group = mTable.GetElement(i);
+		if (Group.Capacity != 0)
+		{
+			const ElementType* Source = Group.Elements;
+
+			Group.Elements = AllocatorType::Allocate(Group.Size);
+			Group.Capacity = Group.Size;
+
+			for (size_t j = 0; j < Group.Size; j++)
+			{
+				new (Group.Elements + j) ElementType(Source[j]);
+			}
+		}
+	}
+}
+
+template<class Traits, class Layout>
+void GroupedHashTable<Traits, Layout>::DestroyArrays()
+{
+	if (mTable.GetSize() == 0)
+	{
+		return;
+	}
+
+	for (size_t i = mTable.SkipEmpty(0); i != mTable.GetEndIndex(); i = mTable.SkipEmpty(i + 1))
+	{
+		GroupType& Group = mTable.GetElement(i);
+		if (Group.Capacity != 0)
+		{
+			if constexpr (!TypeTraits::IsTriviallyDestructible<ElementType>)
+			{
+				for (size_t j = 0; j < Group.Size; j++)
+				{
+					Group.Elements[j].~ElementType();
+				}
+			}
+			AllocatorType::Deallocate(Group.Elements);
+		}
+	}
+}
+
+} // namespace kw
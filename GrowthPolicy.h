@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Concepts.h"
+
+#include <bit>
+
+namespace kw
+{
+
+// Growth policies decide how much memory a container allocates when it runs out of capacity. Every policy provides
+// `GetCapacity<T>(capacity, requiredCapacity, allocator)` that returns the new capacity, which is never less than
+// `requiredCapacity`. Policies are stateless, they're passed as a template parameter to containers like `Vector`.
+
+// Double the capacity on every growth. Fewest reallocations, but up to 2x memory overshoot. Default policy.
+struct DoublingGrowthPolicy
+{
+    template <class T, class Allocator>
+    static size_t GetCapacity(size_t capacity, size_t requiredCapacity, const Allocator& /* allocator */)
+    {
+        size_t desiredCapacity = capacity > 0 ? capacity * 2 : 1;
+        return desiredCapacity > requiredCapacity ? desiredCapacity : requiredCapacity;
+    }
+};
+
+// Grow the capacity by 1.5x. Less memory overshoot than doubling at the cost of more frequent reallocations.
+struct OneAndHalfGrowthPolicy
+{
+    template <class T, class Allocator>
+    static size_t GetCapacity(size_t capacity, size_t requiredCapacity, const Allocator& /* allocator */)
+    {
+        // `+ 1` makes sure the capacity always grows, even for capacity of 1.
+        size_t desiredCapacity = capacity + capacity / 2 + 1;
+        return desiredCapacity > requiredCapacity ? desiredCapacity : requiredCapacity;
+    }
+};
+
+// Grow the capacity by the golden ratio (~1.618x). This is the largest factor at which the sum of all previously
+// freed blocks eventually becomes large enough to fit the next allocation, letting the allocator reuse them.
+struct GoldenRatioGrowthPolicy
+{
+    template <class T, class Allocator>
+    static size_t GetCapacity(size_t capacity, size_t requiredCapacity, const Allocator& /* allocator */)
+    {
+        // 1 + 1/2 + 1/8 - 1/128 = 1.6171875. Shifts don't overflow unlike multiplication by a fraction.
+        size_t desiredCapacity = capacity + (capacity >> 1) + (capacity >> 3) - (capacity >> 7) + 1;
+        return desiredCapacity > requiredCapacity ? desiredCapacity : requiredCapacity;
+    }
+};
+
+// Grow the capacity using the given base policy, then round large blocks up to the page size. Allocations of this
+// size are usually served directly by the OS in whole pages, so the rounded up tail comes for free.
+template <class BasePolicy = OneAndHalfGrowthPolicy, size_t PageSize = 4096>
+struct PageGrowthPolicy
+{
+    static_assert((PageSize & (PageSize - 1)) == 0, "Page size must be a power of two.");
+
+    template <class T, class Allocator>
+    static size_t GetCapacity(size_t capacity, size_t requiredCapacity, const Allocator& allocator)
+    {
+        size_t desiredCapacity = BasePolicy::template GetCapacity<T>(capacity, requiredCapacity, allocator);
+
+        size_t size = desiredCapacity * sizeof(T);
+        if (size >= PageSize)
+        {
+            size = (size + PageSize - 1) & ~(PageSize - 1);
+            desiredCapacity = size / sizeof(T);
+        }
+
+        return desiredCapacity;
+    }
+};
+
+// Grow the capacity using the given base policy, then round it up to the size that the allocator actually returns
+// for such request. Allocators report it via `GetUsableCount` (see `SizeClassAwareAllocator`). For other allocators
+// size classes of typical general-purpose allocators are assumed. This notably helps tiny containers: a vector of
+// `char` starts with the capacity of 16 rather than going through 1, 2, 4, and 8.
+template <class BasePolicy = OneAndHalfGrowthPolicy>
+struct SizeClassGrowthPolicy
+{
+    template <class T, class Allocator>
+    static size_t GetCapacity(size_t capacity, size_t requiredCapacity, const Allocator& allocator)
+    {
+        size_t desiredCapacity = BasePolicy::template GetCapacity<T>(capacity, requiredCapacity, allocator);
+
+        if constexpr (SizeClassAwareAllocator<Allocator, T>)
+        {
+            return allocator.GetUsableCount(desiredCapacity);
+        }
+        else
+        {
+            return RoundUpToSizeClass(desiredCapacity * sizeof(T)) / sizeof(T);
+        }
+    }
+
+    static size_t RoundUpToSizeClass(size_t size)
+    {
+        if (size <= 128)
+        {
+            // 16-byte quantum for small sizes.
+            return (size + 15) & ~static_cast<size_t>(15);
+        }
+        else
+        {
+            // Four size classes per power of two, e.g. 160, 192, 224, 256, 320, 384, 448, 512...
+            size_t spacing = static_cast<size_t>(1) << (std::bit_width(size - 1) - 3);
+            return (size + spacing - 1) & ~(spacing - 1);
+        }
+    }
+};
+
+} // namespace kw
@@ -1,27 +1,51 @@
 #pragma once
 
+#include "ArrayView.h"
+#include "Assert.h"
+#include "CompactHashTable.h"
 #include "Concepts.h"
+#include "ContainerUtils.h"
+#include "GroupedHashTable.h"
+#include "HashTraits.h"
+#include "IncrementalHashTable.h"
 #include "Iterators.h"
+#include "NodeHashTable.h"
 #include "Pair.h"
+#include "RobinHoodHashTable.h"
+#include "SwissHashTable.h"
+#include "Utility.h"
 
+#include <bit>
 #include <initializer_list>
+#include <new>
+#include <thread>
 
 namespace kw
 {
 
-// TODO: Description
-template<class Key, class ElementType, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys>
-class HashBase
+// Base of all hash containers: an open addressing hash table. The memory layout of the table is selected by the
+// `Layout` parameter, see `RobinHoodHashLayout` (the default), `SwissHashLayout`, and `CompactHashLayout`.
+// `IncrementalHashLayout` wraps any of them to spread the growth of the table over insertions. Equal keys in multi key
+// containers are kept next to each other, and `GroupedHashLayout` stores them in a single slot. Insertion and erasure
+// invalidate iterators, pointers, and references to elements, except that `NodeHashLayout` keeps pointers and
+// references valid.
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout = RobinHoodHashLayout>
+class HashBase : protected Layout::template Table<HashTraits<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys>>
 {
+protected:
+	using TraitsType = HashTraits<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys>;
+	using TableType = typename Layout::template Table<TraitsType>;
+
 public:
 	using KeyType = Key;
-	using ElementType = ElementType;
+	using ElementType = T;
 	using ElementHashType = ElementHash;
 	using ElementEqualType = ElementEqual;
 	using AllocatorType = Allocator;
+	using LayoutType = Layout;
 
-	using Iterator = RandomAccessIterator<ElementType>;
-	using ConstIterator = RandomAccessIterator<const ElementType>;
+	using Iterator = typename TableType::Iterator;
+	using ConstIterator = typename TableType::ConstIterator;
 	using ReverseIterator = ::kw::ReverseIterator<Iterator>;
 	using ConstReverseIterator = ::kw::ReverseIterator<ConstIterator>;
 
@@ -39,16 +63,20 @@ public:
 	template<ForwardIterator<ElementType> InIterator>
 	HashBase(InIterator Begin, InIterator End, const Allocator& InAllocator = Allocator());
 
+	// Same as above, but large ranges are hashed and partitioned on the given number of threads, see `Insert`.
+	template<ForwardIterator<ElementType> InIterator>
+	HashBase(InIterator Begin, InIterator End, size_t ThreadCount, const Allocator& InAllocator = Allocator());
+
+	// Constructs a copy of the given container.
+	HashBase(const HashBase& Other);
+
 	// Constructs a copy of the given container.
 	template<class AnotherAllocator>
-	HashBase(const HashBase<KeyType, ElementType, ElementHashType, ElementEqualType, AnotherAllocator, IsUniqueKeys>& Other, const Allocator& InAllocator = Allocator());
+	HashBase(const HashBase<KeyType, ElementType, ElementHashType, ElementEqualType, AnotherAllocator, IsUniqueKeys, Layout>& Other, const Allocator& InAllocator = Allocator());
 
 	// Constructs a copy of the given container using move semantics.
 	HashBase(HashBase&& Other);
 
-	// Destructs the container.
-	~HashBase();
-
 	// Replaces the contents of this container with the given list's elements.
 	HashBase& operator=(std::initializer_list<ElementType> List);
 
@@ -62,13 +90,31 @@ public:
 	// If the current capacity is already equal or greater, the function does nothing.
 	void Reserve(size_t Capacity);
 
+	// Reallocate the container with the smallest table that fits the given number of elements, but no less than the
+	// current number of elements. Unlike `Reserve`, this can shrink the table.
+	void Rehash(size_t Capacity);
+
+	// Shrink the table to the smallest one that fits the current elements. An empty container frees its memory.
+	void ShrinkToFit();
+
+	// Return the ratio of the number of elements to the number of slots in the table.
+	float GetLoadFactor() const;
+
+	// Return the maximum load factor. The table grows when an insertion would exceed it.
+	float GetMaxLoadFactor() const;
+
+	// Set the maximum load factor. Higher values use less memory, lower values make probe sequences shorter. The value
+	// is clamped to the range the layout supports, e.g. [0.125, 0.95] for `RobinHoodHashLayout`. If the container
+	// exceeds the new maximum load factor, the table grows immediately.
+	void SetMaxLoadFactor(float LoadFactor);
+
 	// Clear the container.
 	void Clear();
 
 	// Insert the given element into the container. If an element with the same key already exists,
 	// return its iterator and false. Otherwise return an iterator to the inserted element and true.
-	Pair<Iterator, bool> Insert(const ElementType& Element);
-	Pair<Iterator, bool> Insert(ElementType&& Element);
+	Pair<Iterator, bool> Insert(const ElementType& InElement);
+	Pair<Iterator, bool> Insert(ElementType&& InElement);
 
 	// Insert all elements of the given list into the container. If any keys in the given list already
 	// exist in this container, they are ignored.
@@ -84,6 +130,12 @@ public:
 	template<ForwardIterator<ElementType> InIterator>
 	void Insert(InIterator Begin, InIterator End);
 
+	// Same as above, but large ranges are hashed and partitioned by home slot on the given number of threads before
+	// the elements are inserted. Then the table is filled front to back instead of at random places, which avoids a
+	// cache miss per element once the table doesn't fit into the cache. The elements are inserted on this thread.
+	template<ForwardIterator<ElementType> InIterator>
+	void Insert(InIterator Begin, InIterator End, size_t ThreadCount);
+
 	// Insert an element into the container constructed in-place from the given arguments. If an element
 	// with the same key already exists in the container, return its iterator and false. Otherwise return
 	// an iterator to the inserted element and true. Useful to avoid unnecessary copy or move operations.
@@ -91,24 +143,75 @@ public:
 	Pair<Iterator, bool> Emplace(InArgs&&... Args);
 
 	// Remove the given element from the container. Iterator must be valid and dereferenceable.
-	Iterator Erase(ConstIterator Iterator);
+	// Return an iterator to the element that follows the removed one.
+	Iterator Erase(ConstIterator Position);
 
 	// Remove an element with the given key from the container. Return how many elements were removed.
-	size_t Erase(const KeyType& Key);
+	size_t Erase(const KeyType& InKey);
 
 	// Return the number of elements with the given key.
-	size_t Count(const KeyType& Key) const;
+	size_t Count(const KeyType& InKey) const;
 
 	// Return an element with the given key. If such element doesn't exist, return end iterator.
-	Iterator Find(const KeyType& Key);
-	ConstIterator Find(const KeyType& Key) const;
+	Iterator Find(const KeyType& InKey);
+	ConstIterator Find(const KeyType& InKey) const;
 
 	// Return a range of elements with the given key. If no such element exists, return a pair of end iterators.
-	Pair<Iterator, Iterator> FindRange(const KeyType& Key);
-	Pair<ConstIterator, ConstIterator> FindRange(const KeyType& Key) const;
+	Pair<Iterator, Iterator> FindRange(const KeyType& InKey);
+	Pair<ConstIterator, ConstIterator> FindRange(const KeyType& InKey) const;
 
 	// Return whether an element with the given key exists in the container.
-	bool Contains(const KeyType& Key) const;
+	bool Contains(const KeyType& InKey) const;
+
+	// Overloads of the functions above for keys of other types, e.g. `StringView` for `String` keys. They don't
+	// construct a temporary key. Only available when both the hasher and the comparator are transparent.
+	template<HashLookupKey<TraitsType> K>
+	size_t Erase(const K& InKey);
+	template<HashLookupKey<TraitsType> K>
+	size_t Count(const K& InKey) const;
+	template<HashLookupKey<TraitsType> K>
+	Iterator Find(const K& InKey);
+	template<HashLookupKey<TraitsType> K>
+	ConstIterator Find(const K& InKey) const;
+	template<HashLookupKey<TraitsType> K>
+	Pair<Iterator, Iterator> FindRange(const K& InKey);
+	template<HashLookupKey<TraitsType> K>
+	Pair<ConstIterator, ConstIterator> FindRange(const K& InKey) const;
+	template<HashLookupKey<TraitsType> K>
+	bool Contains(const K& InKey) const;
+
+	// Return the hash of the given key as it's computed by the container. Useful for the functions below.
+	static size_t GetHash(const KeyType& InKey);
+	template<HashLookupKey<TraitsType> K>
+	static size_t GetHash(const K& InKey);
+
+	// Same as the functions above, but take the hash of the key instead of computing it, which must be equal to
+	// `GetHash(Key)`. Useful to hash a key once and look it up in several containers, or to hash a batch of keys
+	// before looking them up.
+	Pair<Iterator, bool> InsertWithHash(const ElementType& InElement, size_t Hash);
+	Pair<Iterator, bool> InsertWithHash(ElementType&& InElement, size_t Hash);
+	size_t EraseWithHash(const KeyType& InKey, size_t Hash);
+	Iterator FindWithHash(const KeyType& InKey, size_t Hash);
+	ConstIterator FindWithHash(const KeyType& InKey, size_t Hash) const;
+	template<HashLookupKey<TraitsType> K>
+	size_t EraseWithHash(const K& InKey, size_t Hash);
+	template<HashLookupKey<TraitsType> K>
+	Iterator FindWithHash(const K& InKey, size_t Hash);
+	template<HashLookupKey<TraitsType> K>
+	ConstIterator FindWithHash(const K& InKey, size_t Hash) const;
+
+	// Start loading the memory that a lookup of a key with the given hash reads first, without waiting for it.
+	// Prefetching the hashes of a batch of keys some lookups ahead hides the latency of cache misses.
+	void Prefetch(size_t Hash) const;
+
+	// Look up all the given keys and write an iterator to the element with each key, or the end iterator, to the
+	// result array of the same size. Keys are hashed and their memory is prefetched in groups before any of them is
+	// probed, so cache misses of the whole group overlap instead of being paid one after another.
+	void FindBatch(ArrayView<KeyType> Keys, Iterator* Result);
+	void FindBatch(ArrayView<KeyType> Keys, ConstIterator* Result) const;
+
+	// Same as `FindBatch`, but write whether an element with each key exists in the container.
+	void ContainsBatch(ArrayView<KeyType> Keys, bool* Result) const;
 
 	// Return an iterator to the beginning.
 	Iterator GetBegin();
@@ -142,25 +245,813 @@ public:
 	// Return how many elements are stored in the container.
 	size_t GetSize() const;
 
-	// Return how many elements are allocated in the container.
+	// Return how many elements the container can store without rehashing.
 	size_t GetCapacity() const;
 
 	// Return the associated allocator.
 	const Allocator& GetAllocator() const;
 
 protected:
-	static constexpr uint32_t Empty = 0xFFFFFFFFU;
-	static constexpr uint32_t Erased = 0xFFFFFFFEU;
+	template<class, class, class, class, class, bool, class>
+	friend class HashBase;
+
+	// How many keys `FindBatch` hashes and prefetches at once. Enough to keep all line fill buffers busy, while the
+	// prefetched memory still fits into L1.
+	static constexpr size_t BatchGroupSize = 16;
 
-	struct Node
+	// Call the given function with the position of each key in the given array and the index of its element.
+	template<class Function>
+	void FindBatchIndices(ArrayView<KeyType> Keys, Function&& Callback) const;
+
+	// Range insertions of at least this many elements are partitioned by home slot. Smaller tables fit into the cache,
+	// where inserting in random order is just as fast.
+	static constexpr size_t MinPartitionedInsertSize = 65536;
+
+	// Partitions of a range insertion span about 2^10 elements each, but there are no more than 2^12 of them, since
+	// scattering the elements to more places at once thrashes the TLB.
+	static constexpr size_t PartitionSizeBits = 10;
+	static constexpr size_t MaxPartitionBits = 12;
+
+	struct PartitionEntry
 	{
-		ElementType Element;
-		uint32_t Distance;
+		const ElementType* Element;
+		size_t Hash;
 	};
 
-	Node* mNodes;
-	size_t mSize;
-	size_t mCapacity;
+	// Insert the given number of elements that start at the given iterator in the order of their home slots.
+	template<class InIterator>
+	void InsertPartitioned(InIterator Begin, size_t Count, size_t ThreadCount);
+
+	// Call the given function with each thread index from 0 to the given count, each on its own thread.
+	template<class Function>
+	void RunOnThreads(size_t ThreadCount, Function&& Callback) const;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(const Allocator& InAllocator)
+	: TableType(InAllocator)
+{
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(std::initializer_list<ElementType> List, const Allocator& InAllocator)
+	: HashBase(InAllocator)
+{
+	Insert(List);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterable<T> Container>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(const Container& InContainer, const Allocator& InAllocator)
+	: HashBase(InAllocator)
+{
+	Insert(ContainerUtils::GetBegin(InContainer), ContainerUtils::GetEnd(InContainer));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterator<T> InIterator>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(InIterator Begin, InIterator End, const Allocator& InAllocator)
+	: HashBase(InAllocator)
+{
+	Insert(Begin, End);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterator<T> InIterator>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(InIterator Begin, InIterator End, size_t ThreadCount, const Allocator& InAllocator)
+	: HashBase(InAllocator)
+{
+	Insert(Begin, End, ThreadCount);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(const HashBase& Other)
+	: TableType(Other)
+{
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<class AnotherAllocator>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(const HashBase<KeyType, ElementType, ElementHashType, ElementEqualType, AnotherAllocator, IsUniqueKeys, Layout>& Other, const Allocator& InAllocator)
+	: TableType(static_cast<const typename HashBase<KeyType, ElementType, ElementHashType, ElementEqualType, AnotherAllocator, IsUniqueKeys, Layout>::TableType&>(Other), InAllocator)
+{
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::HashBase(HashBase&& Other)
+	: TableType(static_cast<TableType&&>(Other))
+{
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>& HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::operator=(std::initializer_list<ElementType> List)
+{
+	Clear();
+	Insert(List);
+	return *this;
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>& HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::operator=(const HashBase& Other)
+{
+	TableType::operator=(Other);
+	return *this;
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>& HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::operator=(HashBase&& Other)
+{
+	TableType::operator=(static_cast<TableType&&>(Other));
+	return *this;
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Reserve(size_t Capacity)
+{
+	TableType::Reserve(Capacity);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Rehash(size_t Capacity)
+{
+	TableType::Rehash(Capacity);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ShrinkToFit()
+{
+	TableType::Rehash(0);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+float HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetLoadFactor() const
+{
+	return TableType::GetLoadFactor();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+float HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetMaxLoadFactor() const
+{
+	return TableType::GetMaxLoadFactor();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::SetMaxLoadFactor(float LoadFactor)
+{
+	TableType::SetMaxLoadFactor(LoadFactor);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Clear()
+{
+	TableType::Clear();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, bool> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(const ElementType& InElement)
+{
+	return InsertWithHash(InElement, TraitsType::GetHash(TraitsType::GetKey(InElement)));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, bool> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(ElementType&& InElement)
+{
+	size_t Hash = TraitsType::GetHash(TraitsType::GetKey(InElement));
+	return InsertWithHash(Move(InElement), Hash);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(std::initializer_list<ElementType> List)
+{
+	Insert(List.begin(), List.end());
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterable<T> InContainer>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(InContainer&& Container)
+{
+	Insert(ContainerUtils::GetBegin(Container), ContainerUtils::GetEnd(Container));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterator<T> InIterator>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(InIterator Begin, InIterator End)
+{
+	Insert(Begin, End, 1);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<ForwardIterator<T> InIterator>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Insert(InIterator Begin, InIterator End, size_t ThreadCount)
+{
+	size_t Count = static_cast<size_t>(Iterators::GetDistance(Begin, End));
+
+	if constexpr (IsUniqueKeys)
+	{
+		// Grow once instead of doubling over and over. Duplicate keys may leave the table larger than necessary. Multi
+		// key layouts may store equal keys in a single slot, so the number of slots they need is unknown.
+		TableType::Reserve(TableType::GetSize() + Count);
+	}
+
+	if (Count >= MinPartitionedInsertSize)
+	{
+		InsertPartitioned(Begin, Count, ThreadCount != 0 ? ThreadCount : 1);
+	}
+	else
+	{
+		for (; Begin != End; ++Begin)
+		{
+			Insert(*Begin);
+		}
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<class... InArgs>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, bool> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Emplace(InArgs&&... Args)
+{
+	// The key is not known until the element is constructed.
+	ElementType NewElement(Forward<InArgs>(Args)...);
+	return Insert(Move(NewElement));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Erase(ConstIterator Position)
+{
+	return this->MakeIterator(this->EraseIndex(this->GetIndex(Position)));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Erase(const KeyType& InKey)
+{
+	return EraseWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Count(const KeyType& InKey) const
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return 0;
+	}
+
+	if constexpr (IsUniqueKeys)
+	{
+		return 1;
+	}
+	else
+	{
+		return this->FindRunEnd(Index) - Index;
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Find(const KeyType& InKey)
+{
+	return FindWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Find(const KeyType& InKey) const
+{
+	return FindWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindRange(const KeyType& InKey)
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return { GetEnd(), GetEnd() };
+	}
+
+	return { this->MakeIterator(Index), this->MakeIterator(this->SkipEmpty(this->FindRunEnd(Index))) };
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator, typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindRange(const KeyType& InKey) const
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return { GetEnd(), GetEnd() };
+	}
+
+	return { this->MakeIterator(Index), this->MakeIterator(this->SkipEmpty(this->FindRunEnd(Index))) };
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+bool HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Contains(const KeyType& InKey) const
+{
+	return this->FindIndex(InKey, TraitsType::GetHash(InKey)) != this->GetEndIndex();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Erase(const K& InKey)
+{
+	return EraseWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Count(const K& InKey) const
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return 0;
+	}
+
+	if constexpr (IsUniqueKeys)
+	{
+		return 1;
+	}
+	else
+	{
+		return this->FindRunEnd(Index) - Index;
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Find(const K& InKey)
+{
+	return FindWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Find(const K& InKey) const
+{
+	return FindWithHash(InKey, TraitsType::GetHash(InKey));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindRange(const K& InKey)
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return { GetEnd(), GetEnd() };
+	}
+
+	return { this->MakeIterator(Index), this->MakeIterator(this->SkipEmpty(this->FindRunEnd(Index))) };
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator, typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindRange(const K& InKey) const
+{
+	size_t Index = this->FindIndex(InKey, TraitsType::GetHash(InKey));
+	if (Index == this->GetEndIndex())
+	{
+		return { GetEnd(), GetEnd() };
+	}
+
+	return { this->MakeIterator(Index), this->MakeIterator(this->SkipEmpty(this->FindRunEnd(Index))) };
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+bool HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Contains(const K& InKey) const
+{
+	return this->FindIndex(InKey, TraitsType::GetHash(InKey)) != this->GetEndIndex();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetHash(const KeyType& InKey)
+{
+	return TraitsType::GetHash(InKey);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetHash(const K& InKey)
+{
+	return TraitsType::GetHash(InKey);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, bool> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::InsertWithHash(const ElementType& InElement, size_t Hash)
+{
+	if constexpr (!IsUniqueKeys)
+	{
+		// The given element may be stored in this container and get shifted by the insertion.
+		ElementType Copy(InElement);
+		return InsertWithHash(Move(Copy), Hash);
+	}
+	else
+	{
+		const KeyType& ElementKey = TraitsType::GetKey(InElement);
+		KW_ASSERT(Hash == TraitsType::GetHash(ElementKey), "Invalid hash.");
+
+		Pair<size_t, bool> Result = this->FindOrPrepareInsert(ElementKey, Hash);
+		if (Result.Value)
+		{
+			new (&this->GetElement(Result.Key)) ElementType(InElement);
+		}
+
+		return { this->MakeIterator(Result.Key), Result.Value };
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+Pair<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator, bool> HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::InsertWithHash(ElementType&& InElement, size_t Hash)
+{
+	const KeyType& ElementKey = TraitsType::GetKey(InElement);
+	KW_ASSERT(Hash == TraitsType::GetHash(ElementKey), "Invalid hash.");
+
+	Pair<size_t, bool> Result = this->FindOrPrepareInsert(ElementKey, Hash);
+	if (Result.Value)
+	{
+		new (&this->GetElement(Result.Key)) ElementType(Move(InElement));
+	}
+
+	return { this->MakeIterator(Result.Key), Result.Value };
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::EraseWithHash(const KeyType& InKey, size_t Hash)
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	size_t Index = this->FindIndex(InKey, Hash);
+	if (Index == this->GetEndIndex())
+	{
+		return 0;
+	}
+
+	if constexpr (IsUniqueKeys)
+	{
+		this->EraseIndex(Index);
+		return 1;
+	}
+	else
+	{
+		// The given key may belong to one of the erased elements, so the run is measured before erasing it.
+		size_t Count = this->FindRunEnd(Index) - Index;
+		this->EraseRun(Index, Count);
+		return Count;
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindWithHash(const KeyType& InKey, size_t Hash)
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	return this->MakeIterator(this->FindIndex(InKey, Hash));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindWithHash(const KeyType& InKey, size_t Hash) const
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	return this->MakeIterator(this->FindIndex(InKey, Hash));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::EraseWithHash(const K& InKey, size_t Hash)
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	size_t Index = this->FindIndex(InKey, Hash);
+	if (Index == this->GetEndIndex())
+	{
+		return 0;
+	}
+
+	if constexpr (IsUniqueKeys)
+	{
+		this->EraseIndex(Index);
+		return 1;
+	}
+	else
+	{
+		// The given key may belong to one of the erased elements, so the run is measured before erasing it.
+		size_t Count = this->FindRunEnd(Index) - Index;
+		this->EraseRun(Index, Count);
+		return Count;
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindWithHash(const K& InKey, size_t Hash)
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	return this->MakeIterator(this->FindIndex(InKey, Hash));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<HashLookupKey<typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::TraitsType> K>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindWithHash(const K& InKey, size_t Hash) const
+{
+	KW_ASSERT(Hash == TraitsType::GetHash(InKey), "Invalid hash.");
+
+	return this->MakeIterator(this->FindIndex(InKey, Hash));
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Prefetch(size_t Hash) const
+{
+	TableType::Prefetch(Hash);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindBatch(ArrayView<KeyType> Keys, Iterator* Result)
+{
+	FindBatchIndices(Keys, [&](size_t Position, size_t Index)
+	{
+		Result[Position] = this->MakeIterator(Index);
+	});
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindBatch(ArrayView<KeyType> Keys, ConstIterator* Result) const
+{
+	FindBatchIndices(Keys, [&](size_t Position, size_t Index)
+	{
+		Result[Position] = this->MakeIterator(Index);
+	});
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ContainsBatch(ArrayView<KeyType> Keys, bool* Result) const
+{
+	FindBatchIndices(Keys, [&](size_t Position, size_t Index)
+	{
+		Result[Position] = Index != this->GetEndIndex();
+	});
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<class Function>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::FindBatchIndices(ArrayView<KeyType> Keys, Function&& Callback) const
+{
+	size_t Hashes[BatchGroupSize];
+
+	for (size_t GroupBegin = 0; GroupBegin < Keys.GetSize(); GroupBegin += BatchGroupSize)
+	{
+		size_t GroupSize = Keys.GetSize() - GroupBegin < BatchGroupSize ? Keys.GetSize() - GroupBegin : BatchGroupSize;
+
+		for (size_t i = 0; i < GroupSize; i++)
+		{
+			Hashes[i] = TraitsType::GetHash(Keys[GroupBegin + i]);
+			TableType::Prefetch(Hashes[i]);
+		}
+
+		for (size_t i = 0; i < GroupSize; i++)
+		{
+			Callback(GroupBegin + i, this->FindIndex(Keys[GroupBegin + i], Hashes[i]));
+		}
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<class InIterator>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::InsertPartitioned(InIterator Begin, size_t Count, size_t ThreadCount)
+{
+	using EntryAllocator = typename HashDetails::RebindAllocator<Allocator, PartitionEntry>::Type;
+	using CountAllocator = typename HashDetails::RebindAllocator<Allocator, size_t>::Type;
+
+	// All layouts take the home slot from the top bits of the hash multiplied by this constant, so partitions that
+	// follow each other in this order cover slots that follow each other in the table.
+	size_t PartitionBits = std::bit_width(Count) - 1 - PartitionSizeBits;
+	PartitionBits = PartitionBits < MaxPartitionBits ? PartitionBits : MaxPartitionBits;
+	size_t PartitionCount = static_cast<size_t>(1) << PartitionBits;
+
+	auto GetPartition = [PartitionBits](size_t Hash)
+	{
+		return static_cast<size_t>((static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ULL) >> (64 - PartitionBits));
+	};
+
+	EntryAllocator Entries(GetAllocator());
+	CountAllocator Counts(GetAllocator());
+
+	PartitionEntry* Source = Entries.Allocate(Count);
+	PartitionEntry* Destination = Entries.Allocate(Count);
+
+	// Each thread counts the elements of every partition in its own part of the range.
+	size_t* Offsets = Counts.Allocate(ThreadCount * PartitionCount);
+	for (size_t i = 0; i < ThreadCount * PartitionCount; i++)
+	{
+		Offsets[i] = 0;
+	}
+
+	for (size_t i = 0; i < Count; ++i, ++Begin)
+	{
+		Source[i].Element = &*Begin;
+	}
+
+	RunOnThreads(ThreadCount, [&](size_t Thread)
+	{
+		size_t* ThreadOffsets = Offsets + Thread * PartitionCount;
+		for (size_t i = Count * Thread / ThreadCount; i < Count * (Thread + 1) / ThreadCount; i++)
+		{
+			Source[i].Hash = TraitsType::GetHash(TraitsType::GetKey(*Source[i].Element));
+			ThreadOffsets[GetPartition(Source[i].Hash)]++;
+		}
+	});
+
+	// Turn the counts into the offsets where each thread writes the elements of each partition. The elements keep
+	// their relative order, so equal keys are inserted in the order of the range.
+	size_t Offset = 0;
+	for (size_t Partition = 0; Partition < PartitionCount; Partition++)
+	{
+		for (size_t Thread = 0; Thread < ThreadCount; Thread++)
+		{
+			size_t PartitionSize = Offsets[Thread * PartitionCount + Partition];
+			Offsets[Thread * PartitionCount + Partition] = Offset;
+			Offset += PartitionSize;
+		}
+	}
+
+	RunOnThreads(ThreadCount, [&](size_t Thread)
+	{
+		size_t* ThreadOffsets = Offsets + Thread * PartitionCount;
+		for (size_t i = Count * Thread / ThreadCount; i < Count * (Thread + 1) / ThreadCount; i++)
+		{
+			Destination[ThreadOffsets[GetPartition(Source[i].Hash)]++] = Source[i];
+		}
+	});
+
+	for (size_t i = 0; i < Count; i++)
+	{
+		// Home slots are only sorted between partitions, and the range is read out of order, so prefetch both.
+		if (i + BatchGroupSize < Count)
+		{
+			TableType::Prefetch(Destination[i + BatchGroupSize].Hash);
+			KW_PREFETCH(Destination[i + BatchGroupSize].Element);
+		}
+
+		InsertWithHash(*Destination[i].Element, Destination[i].Hash);
+	}
+
+	Counts.Deallocate(Offsets);
+	Entries.Deallocate(Destination);
+	Entries.Deallocate(Source);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+template<class Function>
+void HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::RunOnThreads(size_t ThreadCount, Function&& Callback) const
+{
+	using ThreadAllocator = typename HashDetails::RebindAllocator<Allocator, std::thread>::Type;
+
+	if (ThreadCount == 1)
+	{
+		Callback(0);
+		return;
+	}
+
+	ThreadAllocator Threads(GetAllocator());
+	std::thread* ThreadArray = Threads.Allocate(ThreadCount);
+
+	// This thread takes the first part of the work.
+	for (size_t i = 1; i < ThreadCount; i++)
+	{
+		new (&ThreadArray[i]) std::thread(Callback, i);
+	}
+
+	Callback(0);
+
+	for (size_t i = 1; i < ThreadCount; i++)
+	{
+		ThreadArray[i].join();
+		ThreadArray[i].~thread();
+	}
+
+	Threads.Deallocate(ThreadArray);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetBegin()
+{
+	return TableType::GetBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetBegin() const
+{
+	return TableType::GetBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetConstBegin() const
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetEnd()
+{
+	return TableType::GetEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetEnd() const
+{
+	return TableType::GetEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetConstEnd() const
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetReverseBegin()
+{
+	return ReverseIterator(this->GetLast());
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetReverseBegin() const
+{
+	return ConstReverseIterator(this->GetLast());
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetConstReverseBegin() const
+{
+	return GetReverseBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetReverseEnd()
+{
+	return ReverseIterator(this->GetBeforeBegin());
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetReverseEnd() const
+{
+	return ConstReverseIterator(this->GetBeforeBegin());
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstReverseIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetConstReverseEnd() const
+{
+	return GetReverseEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::begin()
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::begin() const
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::Iterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::end()
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+typename HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::ConstIterator HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::end() const
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+bool HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::IsEmpty() const
+{
+	return GetSize() == 0;
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetSize() const
+{
+	return TableType::GetSize();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+size_t HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetCapacity() const
+{
+	return TableType::GetCapacity();
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys, class Layout>
+const Allocator& HashBase<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys, Layout>::GetAllocator() const
+{
+	return TableType::GetAllocator();
+}
+
 } // namespace kw
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Assert.h"
 #include "HashBase.h"
 #include "MallocAllocator.h"
 #include "Pair.h"
@@ -10,16 +11,75 @@ namespace kw
 
 // An associative container that contains key-value pairs with unique keys.
 // Search, insertion, and removal of elements have average constant-time complexity.
-template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>>
-class HashMap : public HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, false>
+template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>, class Layout = RobinHoodHashLayout>
+class HashMap : public HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, true, Layout>
 {
+	using BaseType = HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, true, Layout>;
+
 public:
+	using typename BaseType::KeyType;
+	using typename BaseType::ElementType;
+	using typename BaseType::Iterator;
 	using ValueType = Value;
 	using KeyHashType = KeyHash;
 	using KeyEqualType = KeyEqual;
 
+	using BaseType::BaseType;
+	using BaseType::operator=;
+
 	// Return an element with given key. If there's no element with the given key, create and return this element.
-	ValueType& operator[](const KeyType& Key);
+	ValueType& operator[](const KeyType& InKey);
+
+	// Insert an element with the given key and value, or assign the given value to the element with the given key if
+	// it exists. Return an iterator to the element and whether it was inserted.
+	template<class V>
+	Pair<Iterator, bool> InsertOrAssign(const KeyType& InKey, V&& InValue);
+
+	// Same as the function above, but takes the hash of the key, which must be equal to `GetHash(Key)`.
+	template<class V>
+	Pair<Iterator, bool> InsertOrAssignWithHash(const KeyType& InKey, V&& InValue, size_t Hash);
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ValueType& HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::operator[](const KeyType& InKey)
+{
+	// Hash and probe only once, the value is default constructed only for a new element.
+	Pair<size_t, bool> Result = this->FindOrPrepareInsert(InKey, BaseType::TraitsType::GetHash(InKey));
+	if (Result.Value)
+	{
+		new (&this->GetElement(Result.Key)) ElementType{ InKey, ValueType() };
+	}
+
+	return this->GetElement(Result.Key).Value;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+template<class V>
+Pair<typename HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Iterator, bool> HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::InsertOrAssign(const KeyType& InKey, V&& InValue)
+{
+	return InsertOrAssignWithHash(InKey, Forward<V>(InValue), BaseType::TraitsType::GetHash(InKey));
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+template<class V>
+Pair<typename HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Iterator, bool> HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::InsertOrAssignWithHash(const KeyType& InKey, V&& InValue, size_t Hash)
+{
+	KW_ASSERT(Hash == BaseType::TraitsType::GetHash(InKey), "Invalid hash.");
+
+	// Probe only once, an existing value is assigned in place.
+	Pair<size_t, bool> Result = this->FindOrPrepareInsert(InKey, Hash);
+	if (Result.Value)
+	{
+		new (&this->GetElement(Result.Key)) ElementType{ InKey, Forward<V>(InValue) };
+	}
+	else
+	{
+		this->GetElement(Result.Key).Value = Forward<V>(InValue);
+	}
+
+	return { this->MakeIterator(Result.Key), Result.Value };
+}
+
 } // namespace kw
@@ -10,13 +10,18 @@ namespace kw
 
 // An associative container that contains key-value pairs that supports equivalent keys.
 // Search, insertion, and removal of elements have average constant-time complexity.
-template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>>
-class HashMultiMap : public HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, true>
+template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>, class Layout = GroupedHashLayout<>>
+class HashMultiMap : public HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, false, Layout>
 {
+	using BaseType = HashBase<Key, Pair<const Key, Value>, PairKeyHash<const Key, Value, KeyHash>, PairKeyEqualTo<const Key, Value, KeyEqual>, Allocator, false, Layout>;
+
 public:
 	using ValueType = Value;
 	using KeyHashType = KeyHash;
 	using KeyEqualType = KeyEqual;
+
+	using BaseType::BaseType;
+	using BaseType::operator=;
 };
 
 } // namespace kw
@@ -9,12 +9,17 @@ namespace kw
 
 // An associative container that contains set of possibly non-unique objects of the specified type.
 // Search, insertion, and removal have average constant-time complexity.
-template<class Key, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Key>>
-class HashMultiSet : public HashBase<Key, Key, KeyHash, KeyEqual, Allocator, true>
+template<class Key, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Key>, class Layout = GroupedHashLayout<>>
+class HashMultiSet : public HashBase<Key, Key, KeyHash, KeyEqual, Allocator, false, Layout>
 {
+	using BaseType = HashBase<Key, Key, KeyHash, KeyEqual, Allocator, false, Layout>;
+
 public:
 	using KeyHashType = KeyHash;
 	using KeyEqualType = KeyEqual;
+
+	using BaseType::BaseType;
+	using BaseType::operator=;
 };
 
 } // namespace kw
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Concepts.h"
+#include "TypeTraits.h"
+
+namespace kw
+{
+
+namespace HashDetails
+{
+
+// Allocator of the same family for another element type, e.g. `MallocAllocator<Node>` for `MallocAllocator<T>`.
+// The allocator must be constructible from the allocator of the original type.
+template<class Allocator, class T>
+struct RebindAllocator;
+
+template<template<class> class Allocator, class U, class T>
+struct RebindAllocator<Allocator<U>, T>
+{
+	using Type = Allocator<T>;
+};
+
+} // namespace HashDetails
+
+// Types and key functions of a hash container. Hash table layouts (see `HashBase`) are parameterized by these.
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys>
+struct HashTraits
+{
+	using KeyType = Key;
+	using ElementType = T;
+	using ElementHashType = ElementHash;
+	using ElementEqualType = ElementEqual;
+	using AllocatorType = Allocator;
+
+	// Whether a key can appear only once in the container. Equal keys of multi key containers are stored next to
+	// each other, so they form a contiguous range in the iteration order.
+	static constexpr bool IsUnique = IsUniqueKeys;
+
+	// Whether the hasher and the comparator accept keys of other types, see `HashLookupKey`.
+	static constexpr bool IsTransparent = Transparent<ElementHash> && Transparent<ElementEqual>;
+
+	// Return the key of the given element. Elements of maps are pairs, elements of sets are keys themselves.
+	static const KeyType& GetKey(const ElementType& Element);
+
+	// Return the hash of the given key, which is either `KeyType` or a `HashLookupKey`.
+	template<class K>
+	static size_t GetHash(const K& InKey);
+
+	// Return whether the given stored key is equal to the given key, which is either `KeyType` or a `HashLookupKey`.
+	template<class K>
+	static bool IsEqual(const KeyType& Lhs, const K& Rhs);
+};
+
+// Specifies whether keys of type K can be looked up in hash containers with the given traits as they are, without
+// conversion to the key type. Transparent hashers must return the same hash for the key and its converted value.
+template<class K, class Traits>
+concept HashLookupKey = Traits::IsTransparent &&
+                        Invocable<const typename Traits::ElementHashType&, const K&> &&
+                        Invocable<const typename Traits::ElementEqualType&, const typename Traits::KeyType&, const K&>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys>
+const Key& HashTraits<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys>::GetKey(const ElementType& Element)
+{
+	if constexpr (TypeTraits::IsSame<KeyType, ElementType>)
+	{
+		return Element;
+	}
+	else
+	{
+		return Element.Key;
+	}
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys>
+template<class K>
+size_t HashTraits<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys>::GetHash(const K& InKey)
+{
+	return ElementHashType()(InKey);
+}
+
+template<class Key, class T, class ElementHash, class ElementEqual, class Allocator, bool IsUniqueKeys>
+template<class K>
+bool HashTraits<Key, T, ElementHash, ElementEqual, Allocator, IsUniqueKeys>::IsEqual(const KeyType& Lhs, const K& Rhs)
+{
+	return ElementEqualType()(Lhs, Rhs);
+}
+
+} // namespace kw
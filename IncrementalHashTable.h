@@ -0,0 +1,758 @@
+#pragma once
+
+#include "HashTraits.h"
+#include "Pair.h"
+#include "RobinHoodHashTable.h"
+#include "SwissHashTable.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <new>
+
+namespace kw
+{
+
+template<class Traits, class Layout>
+class IncrementalHashTable;
+
+// Bidirectional iterator over elements of `IncrementalHashTable`. While the table migrates, it iterates over the old
+// table first and then jumps to the beginning of the new one.
+template<class InnerIterator, class MutableInnerIterator>
+class IncrementalHashIterator
+{
+public:
+	using ValueType = typename InnerIterator::ValueType;
+
+	IncrementalHashIterator() = default;
+	IncrementalHashIterator(InnerIterator InPosition, bool InIsOld, InnerIterator InOldEnd, InnerIterator InNewBegin);
+	IncrementalHashIterator(const IncrementalHashIterator<MutableInnerIterator, MutableInnerIterator>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	IncrementalHashIterator& operator++();
+	IncrementalHashIterator operator++(int);
+
+	IncrementalHashIterator& operator--();
+	IncrementalHashIterator operator--(int);
+
+	// The other fields only describe the tables, the position alone identifies an element.
+	friend bool operator==(const IncrementalHashIterator& Lhs, const IncrementalHashIterator& Rhs)
+	{
+		return Lhs.mPosition == Rhs.mPosition;
+	}
+
+private:
+	template<class U, class V>
+	friend class IncrementalHashIterator;
+
+	template<class Traits, class Layout>
+	friend class IncrementalHashTable;
+
+	InnerIterator mPosition;
+
+	// Whether the position is in the old table.
+	bool mIsOld;
+
+	// End of the old table and beginning of the new one. Without migration, both are the iterator before the
+	// beginning of the new table, which is never reached by an increment.
+	InnerIterator mOldEnd;
+	InnerIterator mNewBegin;
+};
+
+// Hash table that grows without stalls. When an insertion would rehash the table, the elements stay in the old table,
+// and a new one twice the size is allocated. Every following insertion moves `MigrationStep` elements to the new
+// table, so the migration ends long before the new table is full. Meanwhile lookups and erasures consult both tables.
+// Equal keys of multi key containers always move together, so they stay contiguous. Such a run isn't split between
+// steps, so in multi key containers a single insertion moves up to `MigrationStep` elements plus the longest run of
+// equal keys, and the latency is only bounded for keys with few duplicates. Operations that work with the whole table,
+// like `Reserve` or `Rehash`, finish the migration first. Both tables use `Layout`. See `HashBase` for the interface.
+// Iterators remember where the old table ends, and the erasure of its last element frees it, so like with other tables
+// erasure invalidates all iterators except the returned one.
+template<class Traits, class Layout>
+class IncrementalHashTable
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	using InnerTable = typename Layout::template Table<Traits>;
+
+	using Iterator = IncrementalHashIterator<typename InnerTable::Iterator, typename InnerTable::Iterator>;
+	using ConstIterator = IncrementalHashIterator<typename InnerTable::ConstIterator, typename InnerTable::Iterator>;
+
+	explicit IncrementalHashTable(const AllocatorType& InAllocator);
+	IncrementalHashTable(const IncrementalHashTable& Other);
+	IncrementalHashTable(IncrementalHashTable&& Other);
+
+	template<class OtherTraits>
+	IncrementalHashTable(const IncrementalHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator);
+
+	IncrementalHashTable& operator=(const IncrementalHashTable& Other);
+	IncrementalHashTable& operator=(IncrementalHashTable&& Other);
+
+	void Reserve(size_t Capacity);
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+	void Rehash(size_t Capacity);
+
+	// Indices of the old table come first, followed by the indices of the new table offset by the end index of the
+	// old one. Any migration changes them.
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+	size_t FindRunEnd(size_t Index) const;
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+	bool IsFull() const;
+	void Prefetch(size_t Hash) const;
+
+	// Never migrates elements, so iteration with erasure visits every element once.
+	size_t EraseIndex(size_t Index);
+	void EraseRun(size_t Index, size_t Count);
+
+	size_t SkipEmpty(size_t Index) const;
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits, class OtherLayout>
+	friend class IncrementalHashTable;
+
+	// Minimum number of elements moved to the new table by an insertion. Two or more guarantee that the old table is
+	// empty before the insertions fill the new one.
+	static constexpr size_t MigrationStep = 8;
+
+	bool IsMigrating() const;
+
+	// Return the end index of the old table, which is zero when there's no migration.
+	size_t GetOldEndIndex() const;
+
+	// Move the elements to a new table twice the size, one step at a time.
+	void StartMigration();
+
+	// Move the next `MigrationStep` elements or more to the new table.
+	void MigrateElements();
+
+	// Move all remaining elements to the new table.
+	void FinishMigration();
+
+	// Move the run of equal keys that starts at the given index of the old table to the new table, however long it is.
+	// Free the old table if it's empty afterwards. Return the number of moved elements.
+	size_t MigrateRun(size_t Index);
+
+	Iterator WrapIterator(typename InnerTable::Iterator Position, bool IsOld);
+	ConstIterator WrapIterator(typename InnerTable::ConstIterator Position, bool IsOld) const;
+
+	InnerTable mTable;
+
+	// Elements that are not migrated yet. Empty and without memory when there's no migration.
+	InnerTable mOldTable;
+
+	// Index of the old table before which all elements are migrated.
+	size_t mMigrationIndex;
+};
+
+// Layout of hash containers that uses `IncrementalHashTable` on top of the given layout. Use it when the latency of
+// every insertion matters more than the throughput, e.g. `HashMap<Key, T, Hash<Key>, EqualTo<Key>,
+// MallocAllocator<Pair<const Key, T>>, IncrementalHashLayout<>>`. The insertion that starts a migration still
+// initializes the metadata of the whole new table, which is one control byte per slot for `SwissHashLayout`, but a
+// distance in every node of the element array for `RobinHoodHashLayout`, so the former is the default.
+template<class Layout = SwissHashLayout>
+struct IncrementalHashLayout
+{
+	template<class Traits>
+	using Table = IncrementalHashTable<Traits, Layout>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator>::IncrementalHashIterator(InnerIterator InPosition, bool InIsOld, InnerIterator InOldEnd, InnerIterator InNewBegin)
+	: mPosition(InPosition)
+	, mIsOld(InIsOld)
+	, mOldEnd(InOldEnd)
+	, mNewBegin(InNewBegin)
+{
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator>::IncrementalHashIterator(const IncrementalHashIterator<MutableInnerIterator, MutableInnerIterator>& Other)
+	: mPosition(Other.mPosition)
+	, mIsOld(Other.mIsOld)
+	, mOldEnd(Other.mOldEnd)
+	, mNewBegin(Other.mNewBegin)
+{
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+typename IncrementalHashIterator<InnerIterator, MutableInnerIterator>::ValueType& IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator*() const
+{
+	return *mPosition;
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+typename IncrementalHashIterator<InnerIterator, MutableInnerIterator>::ValueType* IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator->() const
+{
+	return &*mPosition;
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator>& IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator++()
+{
+	++mPosition;
+
+	if (mIsOld && mPosition == mOldEnd)
+	{
+		mPosition = mNewBegin;
+		mIsOld = false;
+	}
+
+	return *this;
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator> IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator++(int)
+{
+	IncrementalHashIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator>& IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator--()
+{
+	if (!mIsOld && mPosition == mNewBegin)
+	{
+		mPosition = mOldEnd;
+		mIsOld = true;
+	}
+
+	--mPosition;
+
+	return *this;
+}
+
+template<class InnerIterator, class MutableInnerIterator>
+IncrementalHashIterator<InnerIterator, MutableInnerIterator> IncrementalHashIterator<InnerIterator, MutableInnerIterator>::operator--(int)
+{
+	IncrementalHashIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits, class Layout>
+IncrementalHashTable<Traits, Layout>::IncrementalHashTable(const AllocatorType& InAllocator)
+	: mTable(InAllocator)
+	, mOldTable(InAllocator)
+	, mMigrationIndex(0)
+{
+}
+
+template<class Traits, class Layout>
+IncrementalHashTable<Traits, Layout>::IncrementalHashTable(const IncrementalHashTable& Other)
+	: mTable(Other.mTable)
+	, mOldTable(Other.mOldTable)
+	, mMigrationIndex(Other.mMigrationIndex)
+{
+}
+
+template<class Traits, class Layout>
+template<class OtherTraits>
+IncrementalHashTable<Traits, Layout>::IncrementalHashTable(const IncrementalHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator)
+	: mTable(Other.mTable, InAllocator)
+	, mOldTable(Other.mOldTable, InAllocator)
+	, mMigrationIndex(Other.mMigrationIndex)
+{
+}
+
+template<class Traits, class Layout>
+IncrementalHashTable<Traits, Layout>::IncrementalHashTable(IncrementalHashTable&& Other)
+	: mTable(static_cast<InnerTable&&>(Other.mTable))
+	, mOldTable(static_cast<InnerTable&&>(Other.mOldTable))
+	, mMigrationIndex(Other.mMigrationIndex)
+{
+	Other.mMigrationIndex = 0;
+}
+
+template<class Traits, class Layout>
+IncrementalHashTable<Traits, Layout>& IncrementalHashTable<Traits, Layout>::operator=(const IncrementalHashTable& Other)
+{
+	if (this != &Other)
+	{
+		mTable = Other.mTable;
+		mOldTable = Other.mOldTable;
+		mMigrationIndex = Other.mMigrationIndex;
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+IncrementalHashTable<Traits, Layout>& IncrementalHashTable<Traits, Layout>::operator=(IncrementalHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		mTable = static_cast<InnerTable&&>(Other.mTable);
+		mOldTable = static_cast<InnerTable&&>(Other.mOldTable);
+		mMigrationIndex = Other.mMigrationIndex;
+
+		Other.mMigrationIndex = 0;
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::Reserve(size_t Capacity)
+{
+	FinishMigration();
+	mTable.Reserve(Capacity);
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::Clear()
+{
+	mOldTable.Clear();
+	mOldTable.Rehash(0);
+	mMigrationIndex = 0;
+
+	mTable.Clear();
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::GetSize() const
+{
+	return mTable.GetSize() + mOldTable.GetSize();
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::GetCapacity() const
+{
+	return mTable.GetCapacity();
+}
+
+template<class Traits, class Layout>
+const typename IncrementalHashTable<Traits, Layout>::AllocatorType& IncrementalHashTable<Traits, Layout>::GetAllocator() const
+{
+	return mTable.GetAllocator();
+}
+
+template<class Traits, class Layout>
+float IncrementalHashTable<Traits, Layout>::GetLoadFactor() const
+{
+	if (IsMigrating())
+	{
+		// The load factor the new table will have when the migration ends.
+		return static_cast<float>(GetSize()) * mTable.GetMaxLoadFactor() / static_cast<float>(mTable.GetCapacity());
+	}
+
+	return mTable.GetLoadFactor();
+}
+
+template<class Traits, class Layout>
+float IncrementalHashTable<Traits, Layout>::GetMaxLoadFactor() const
+{
+	return mTable.GetMaxLoadFactor();
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::SetMaxLoadFactor(float LoadFactor)
+{
+	FinishMigration();
+	mTable.SetMaxLoadFactor(LoadFactor);
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::Rehash(size_t Capacity)
+{
+	FinishMigration();
+	mTable.Rehash(Capacity);
+}
+
+template<class Traits, class Layout>
+template<class K>
+size_t IncrementalHashTable<Traits, Layout>::FindIndex(const K& InKey, size_t Hash) const
+{
+	size_t OldEndIndex = GetOldEndIndex();
+
+	size_t Index = mTable.FindIndex(InKey, Hash);
+	if (Index != mTable.GetEndIndex())
+	{
+		return OldEndIndex + Index;
+	}
+
+	if (IsMigrating())
+	{
+		Index = mOldTable.FindIndex(InKey, Hash);
+		if (Index != OldEndIndex)
+		{
+			return Index;
+		}
+	}
+
+	return GetEndIndex();
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::FindRunEnd(size_t Index) const
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index < OldEndIndex)
+	{
+		return mOldTable.FindRunEnd(Index);
+	}
+
+	return OldEndIndex + mTable.FindRunEnd(Index - OldEndIndex);
+}
+
+template<class Traits, class Layout>
+Pair<size_t, bool> IncrementalHashTable<Traits, Layout>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	if constexpr (Traits::IsUnique)
+	{
+		// The key may belong to an element that the migration below would move, so look it up first.
+		if (IsMigrating() || mTable.IsFull())
+		{
+			size_t Index = FindIndex(InKey, Hash);
+			if (Index != GetEndIndex())
+			{
+				return { Index, false };
+			}
+		}
+	}
+
+	if (!IsMigrating() && mTable.IsFull())
+	{
+		StartMigration();
+	}
+
+	if (IsMigrating())
+	{
+		if constexpr (!Traits::IsUnique)
+		{
+			// Equal keys must stay in one table, so the new element joins them in the new table. `HashBase` passes a
+			// copy of the key to multi key tables, so moving the run doesn't affect it.
+			size_t Index = mOldTable.FindIndex(InKey, Hash);
+			if (Index != mOldTable.GetEndIndex())
+			{
+				MigrateRun(Index);
+			}
+		}
+
+		MigrateElements();
+	}
+
+	Pair<size_t, bool> Result = mTable.FindOrPrepareInsert(InKey, Hash);
+	return { GetOldEndIndex() + Result.Key, Result.Value };
+}
+
+template<class Traits, class Layout>
+bool IncrementalHashTable<Traits, Layout>::IsFull() const
+{
+	return !IsMigrating() && mTable.IsFull();
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::Prefetch(size_t Hash) const
+{
+	mTable.Prefetch(Hash);
+
+	if (IsMigrating())
+	{
+		mOldTable.Prefetch(Hash);
+	}
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::EraseIndex(size_t Index)
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index >= OldEndIndex)
+	{
+		return OldEndIndex + mTable.EraseIndex(Index - OldEndIndex);
+	}
+
+	size_t NextIndex = mOldTable.EraseIndex(Index);
+
+	if (mOldTable.GetSize() == 0)
+	{
+		// The remaining elements are all in the new table, whose indices start from zero now.
+		mOldTable.Rehash(0);
+		mMigrationIndex = 0;
+		return mTable.SkipEmpty(0);
+	}
+
+	if (NextIndex != OldEndIndex)
+	{
+		return NextIndex;
+	}
+
+	return OldEndIndex + mTable.SkipEmpty(0);
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::EraseRun(size_t Index, size_t Count)
+{
+	// Equal keys are always in the same table.
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index >= OldEndIndex)
+	{
+		mTable.EraseRun(Index - OldEndIndex, Count);
+		return;
+	}
+
+	mOldTable.EraseRun(Index, Count);
+
+	if (mOldTable.GetSize() == 0)
+	{
+		mOldTable.Rehash(0);
+		mMigrationIndex = 0;
+	}
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::SkipEmpty(size_t Index) const
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index < OldEndIndex)
+	{
+		Index = mOldTable.SkipEmpty(Index);
+		if (Index != OldEndIndex)
+		{
+			return Index;
+		}
+	}
+
+	return OldEndIndex + mTable.SkipEmpty(Index - OldEndIndex);
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::GetEndIndex() const
+{
+	return GetOldEndIndex() + mTable.GetEndIndex();
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ElementType& IncrementalHashTable<Traits, Layout>::GetElement(size_t Index)
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	return Index < OldEndIndex ? mOldTable.GetElement(Index) : mTable.GetElement(Index - OldEndIndex);
+}
+
+template<class Traits, class Layout>
+const typename IncrementalHashTable<Traits, Layout>::ElementType& IncrementalHashTable<Traits, Layout>::GetElement(size_t Index) const
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	return Index < OldEndIndex ? mOldTable.GetElement(Index) : mTable.GetElement(Index - OldEndIndex);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::MakeIterator(size_t Index)
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index < OldEndIndex)
+	{
+		return WrapIterator(mOldTable.MakeIterator(Index), true);
+	}
+
+	return WrapIterator(mTable.MakeIterator(Index - OldEndIndex), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::MakeIterator(size_t Index) const
+{
+	size_t OldEndIndex = GetOldEndIndex();
+	if (Index < OldEndIndex)
+	{
+		return WrapIterator(mOldTable.MakeIterator(Index), true);
+	}
+
+	return WrapIterator(mTable.MakeIterator(Index - OldEndIndex), false);
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::GetIndex(ConstIterator Position) const
+{
+	if (Position.mIsOld)
+	{
+		return mOldTable.GetIndex(Position.mPosition);
+	}
+
+	return GetOldEndIndex() + mTable.GetIndex(Position.mPosition);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::GetBegin()
+{
+	return IsMigrating() ? WrapIterator(mOldTable.GetBegin(), true) : WrapIterator(mTable.GetBegin(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::GetBegin() const
+{
+	return IsMigrating() ? WrapIterator(mOldTable.GetBegin(), true) : WrapIterator(mTable.GetBegin(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::GetEnd()
+{
+	return WrapIterator(mTable.GetEnd(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::GetEnd() const
+{
+	return WrapIterator(mTable.GetEnd(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::GetLast()
+{
+	return IsMigrating() && mTable.GetSize() == 0 ? WrapIterator(mOldTable.GetLast(), true) : WrapIterator(mTable.GetLast(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::GetLast() const
+{
+	return IsMigrating() && mTable.GetSize() == 0 ? WrapIterator(mOldTable.GetLast(), true) : WrapIterator(mTable.GetLast(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::GetBeforeBegin()
+{
+	return IsMigrating() ? WrapIterator(mOldTable.GetBeforeBegin(), true) : WrapIterator(mTable.GetBeforeBegin(), false);
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::GetBeforeBegin() const
+{
+	return IsMigrating() ? WrapIterator(mOldTable.GetBeforeBegin(), true) : WrapIterator(mTable.GetBeforeBegin(), false);
+}
+
+template<class Traits, class Layout>
+bool IncrementalHashTable<Traits, Layout>::IsMigrating() const
+{
+	return mOldTable.GetSize() != 0;
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::GetOldEndIndex() const
+{
+	return mOldTable.GetEndIndex();
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::StartMigration()
+{
+	size_t Size = mTable.GetSize();
+	if (Size == 0)
+	{
+		// Only tombstones are left, a new table of the minimum size is allocated by the insertion.
+		mTable.Rehash(0);
+		return;
+	}
+
+	// The moved-from table is empty and has no memory, but keeps its maximum load factor.
+	mOldTable = static_cast<InnerTable&&>(mTable);
+	mTable.SetMaxLoadFactor(mOldTable.GetMaxLoadFactor());
+	mTable.Reserve(Size * 2);
+	mMigrationIndex = 0;
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::MigrateElements()
+{
+	size_t Count = 0;
+	while (Count < MigrationStep && IsMigrating())
+	{
+		// Erasure only shifts elements into the erased slot, so no element of the old table precedes the migration
+		// index.
+		mMigrationIndex = mOldTable.SkipEmpty(mMigrationIndex);
+		Count += MigrateRun(mMigrationIndex);
+	}
+}
+
+template<class Traits, class Layout>
+void IncrementalHashTable<Traits, Layout>::FinishMigration()
+{
+	while (IsMigrating())
+	{
+		MigrateElements();
+	}
+}
+
+template<class Traits, class Layout>
+size_t IncrementalHashTable<Traits, Layout>::MigrateRun(size_t Index)
+{
+	size_t Count = 1;
+	if constexpr (!Traits::IsUnique)
+	{
+		Count = mOldTable.FindRunEnd(Index) - Index;
+	}
+
+	for (size_t i = 0; i < Count; i++)
+	{
+		ElementType& Element = mOldTable.GetElement(Index + i);
+		const KeyType& ElementKey = Traits::GetKey(Element);
+
+		Pair<size_t, bool> Result = mTable.FindOrPrepareInsert(ElementKey, Traits::GetHash(ElementKey));
+		new (&mTable.GetElement(Result.Key)) ElementType(Move(Element));
+	}
+
+	// The moved from elements are destroyed together, so the following ones are shifted once.
+	mOldTable.EraseRun(Index, Count);
+
+	if (mOldTable.GetSize() == 0)
+	{
+		mOldTable.Rehash(0);
+		mMigrationIndex = 0;
+	}
+
+	return Count;
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::Iterator IncrementalHashTable<Traits, Layout>::WrapIterator(typename InnerTable::Iterator Position, bool IsOld)
+{
+	if (IsMigrating())
+	{
+		return Iterator(Position, IsOld, mOldTable.GetEnd(), mTable.GetBegin());
+	}
+
+	return Iterator(Position, false, mTable.GetBeforeBegin(), mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename IncrementalHashTable<Traits, Layout>::ConstIterator IncrementalHashTable<Traits, Layout>::WrapIterator(typename InnerTable::ConstIterator Position, bool IsOld) const
+{
+	if (IsMigrating())
+	{
+		return ConstIterator(Position, IsOld, mOldTable.GetEnd(), mTable.GetBegin());
+	}
+
+	return ConstIterator(Position, false, mTable.GetBeforeBegin(), mTable.GetBeforeBegin());
+}
+
+} // namespace kw
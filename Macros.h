@@ -19,3 +19,20 @@
 #define KW_OPTIMIZATION_ON _Pragma("clang optimize on")
 #endif // DEBUG
 #endif // defined(_MSC_VER) && !defined(__clang__)
+
+// SIMD instruction sets enabled at compile time (/arch:AVX2 or -mavx2). SSE2 is always available on x64.
+#if defined(__AVX2__)
+#define KW_SIMD_AVX2
+#endif // defined(__AVX2__)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KW_SIMD_SSE2
+#endif // defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+// Hint the processor to start loading the cache line with the given address. Never faults, even on invalid addresses.
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#define KW_PREFETCH(Address) _mm_prefetch(reinterpret_cast<const char*>(Address), _MM_HINT_T0)
+#else
+#define KW_PREFETCH(Address) __builtin_prefetch(Address)
+#endif // defined(_MSC_VER) && !defined(__clang__)
@@ -10,11 +10,23 @@ template <class T>
 class MallocAllocator
 {
 public:
+    MallocAllocator() = default;
+
+    template <class U>
+    MallocAllocator(const MallocAllocator<U>& other)
+    {
+    }
+
     T* Allocate(size_t count)
     {
         return static_cast<T*>(Memory::Malloc(sizeof(T) * count, alignof(T)));
     }
 
+    T* Reallocate(T* address, size_t /* oldCount */, size_t newCount)
+    {
+        return static_cast<T*>(Memory::Realloc(address, sizeof(T) * newCount, alignof(T)));
+    }
+
     void Deallocate(T* address)
     {
         Memory::Free(address);
@@ -1,16 +1,630 @@
 #include "Memory.h"
 
+#include <atomic>
+#include <bit>
 #include <malloc.h>
+#include <stdint.h>
 #include <string.h>
 
+#if defined(_M_X64) || defined(__x86_64__)
+#define KW_MEMORY_DISPATCH
+#endif // defined(_M_X64) || defined(__x86_64__)
+
+#ifdef KW_MEMORY_DISPATCH
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#endif // defined(_MSC_VER)
+
+// MSVC allows any intrinsics in any function, GCC and Clang require the instruction set to be enabled per function.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define KW_TARGET_AVX2
+#define KW_TARGET_AVX512
+#else
+#define KW_TARGET_AVX2 __attribute__((target("avx2")))
+#define KW_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif // defined(_MSC_VER) && !defined(__clang__)
+#endif // KW_MEMORY_DISPATCH
+
 namespace kw
 {
 
+#ifdef KW_MEMORY_DISPATCH
+
+// `Memcpy`, `Memset` and `Memcmp` pick the implementation on the first call, after checking the CPU features with
+// CPUID. Function pointers are constant-initialized to resolvers, so the functions work during static initialization.
+// Resolvers run the detection once, and the pointers are atomic since other threads call through them meanwhile.
+// Thresholds are written before the pointers are stored with release semantics, and read after they're loaded with
+// acquire semantics, which is a plain load on x86.
+//
+// Copies and fills are split by size:
+//   - below one vector: libc, which handles tiny sizes with a few scalar moves;
+//   - below `s_ermsThreshold`: unrolled AVX-512 or AVX2 loop;
+//   - below `s_nonTemporalThreshold`: `rep movsb`/`rep stosb` when the CPU has ERMS (Enhanced REP MOVSB/STOSB),
+//     otherwise the vector loop;
+//   - above: non-temporal stores that bypass the cache, so huge copies don't evict the working set.
+
+using CopyFunction = void(*)(void*, const void*, size_t);
+using SetFunction = void(*)(void*, int, size_t);
+using CompareFunction = int(*)(const void*, const void*, size_t);
+
+static void ResolveCopy(void* dst, const void* src, size_t size);
+static void ResolveSet(void* dst, int value, size_t size);
+static int ResolveCompare(const void* lhs, const void* rhs, size_t size);
+
+static std::atomic<CopyFunction> s_copyFunction = &ResolveCopy;
+static std::atomic<SetFunction> s_setFunction = &ResolveSet;
+static std::atomic<CompareFunction> s_compareFunction = &ResolveCompare;
+
+// `rep movsb` has a startup cost of a few dozen cycles, vector loops are faster for smaller sizes.
+static constexpr size_t s_ermsThreshold = 2048;
+
+// Set to half of the last level cache: a copy of that size touches the whole cache. Used if CPUID doesn't tell.
+static size_t s_nonTemporalThreshold = 4 * 1024 * 1024;
+
+static bool s_hasErms = false;
+
+static void Cpuid(unsigned leaf, unsigned subleaf, unsigned (&registers)[4])
+{
+#if defined(_MSC_VER)
+    int result[4];
+    __cpuidex(result, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (size_t i = 0; i < 4; i++)
+    {
+        registers[i] = static_cast<unsigned>(result[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif // defined(_MSC_VER)
+}
+
+static uint64_t GetXcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax;
+    unsigned edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif // defined(_MSC_VER)
+}
+
+// Return the size of the largest cache reported by the deterministic cache parameters leaf, or zero.
+static size_t GetCacheSize(unsigned leaf)
+{
+    size_t result = 0;
+
+    for (unsigned subleaf = 0; subleaf < 16; subleaf++)
+    {
+        unsigned registers[4];
+        Cpuid(leaf, subleaf, registers);
+
+        // No more caches.
+        if ((registers[0] & 0x1F) == 0)
+        {
+            break;
+        }
+
+        size_t ways = ((registers[1] >> 22) & 0x3FF) + 1;
+        size_t partitions = ((registers[1] >> 12) & 0x3FF) + 1;
+        size_t lineSize = (registers[1] & 0xFFF) + 1;
+        size_t sets = static_cast<size_t>(registers[2]) + 1;
+
+        size_t size = ways * partitions * lineSize * sets;
+        if (size > result)
+        {
+            result = size;
+        }
+    }
+
+    return result;
+}
+
+static void RepMovsb(void* dst, const void* src, size_t size)
+{
+#if defined(_MSC_VER)
+    __movsb(static_cast<unsigned char*>(dst), static_cast<const unsigned char*>(src), size);
+#else
+    __asm__ volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(size) : : "memory");
+#endif // defined(_MSC_VER)
+}
+
+static void RepStosb(void* dst, int value, size_t size)
+{
+#if defined(_MSC_VER)
+    __stosb(static_cast<unsigned char*>(dst), static_cast<unsigned char>(value), size);
+#else
+    __asm__ volatile("rep stosb" : "+D"(dst), "+c"(size) : "a"(value) : "memory");
+#endif // defined(_MSC_VER)
+}
+
+// Vector loops. `size` must be at least one vector. The last vector is aligned to the end and may overlap the previous
+// one, which is fine since the buffers don't overlap.
+
+KW_TARGET_AVX2 static void CopyAvx2(void* dst, const void* src, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + size - 32));
+    char* end = d + size - 32;
+
+    for (; size > 128; size -= 128, d += 128, s += 128)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 64));
+        __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 96));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 32), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 64), c);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 96), e);
+    }
+
+    for (; size > 32; size -= 32, d += 32, s += 32)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s)));
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(end), tail);
+}
+
+KW_TARGET_AVX2 static void CopyStreamAvx2(void* dst, const void* src, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + size - 32));
+    char* end = d + size - 32;
+
+    // Non-temporal stores must be aligned. Store the unaligned head normally and continue from the aligned address.
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), head);
+    size_t offset = 32 - (reinterpret_cast<uintptr_t>(d) & 31);
+    d += offset;
+    s += offset;
+    size -= offset;
+
+    for (; size >= 128; size -= 128, d += 128, s += 128)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 64));
+        __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d + 96), e);
+    }
+
+    for (; size >= 32; size -= 32, d += 32, s += 32)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s)));
+    }
+
+    // Non-temporal stores are weakly ordered, make them visible before any following store.
+    _mm_sfence();
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(end), tail);
+}
+
+KW_TARGET_AVX512 static void CopyAvx512(void* dst, const void* src, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    __m512i tail = _mm512_loadu_si512(s + size - 64);
+    char* end = d + size - 64;
+
+    for (; size > 256; size -= 256, d += 256, s += 256)
+    {
+        __m512i a = _mm512_loadu_si512(s);
+        __m512i b = _mm512_loadu_si512(s + 64);
+        __m512i c = _mm512_loadu_si512(s + 128);
+        __m512i e = _mm512_loadu_si512(s + 192);
+        _mm512_storeu_si512(d, a);
+        _mm512_storeu_si512(d + 64, b);
+        _mm512_storeu_si512(d + 128, c);
+        _mm512_storeu_si512(d + 192, e);
+    }
+
+    for (; size > 64; size -= 64, d += 64, s += 64)
+    {
+        _mm512_storeu_si512(d, _mm512_loadu_si512(s));
+    }
+
+    _mm512_storeu_si512(end, tail);
+}
+
+KW_TARGET_AVX512 static void CopyStreamAvx512(void* dst, const void* src, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    __m512i head = _mm512_loadu_si512(s);
+    __m512i tail = _mm512_loadu_si512(s + size - 64);
+    char* end = d + size - 64;
+
+    _mm512_storeu_si512(d, head);
+    size_t offset = 64 - (reinterpret_cast<uintptr_t>(d) & 63);
+    d += offset;
+    s += offset;
+    size -= offset;
+
+    for (; size >= 256; size -= 256, d += 256, s += 256)
+    {
+        __m512i a = _mm512_loadu_si512(s);
+        __m512i b = _mm512_loadu_si512(s + 64);
+        __m512i c = _mm512_loadu_si512(s + 128);
+        __m512i e = _mm512_loadu_si512(s + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + 64), b);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + 128), c);
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d + 192), e);
+    }
+
+    for (; size >= 64; size -= 64, d += 64, s += 64)
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d), _mm512_loadu_si512(s));
+    }
+
+    _mm_sfence();
+
+    _mm512_storeu_si512(end, tail);
+}
+
+// SSE2 is always available on x64, it's only used for non-temporal stores on CPUs without AVX2.
+static void CopyStreamSse2(void* dst, const void* src, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + size - 16));
+    char* end = d + size - 16;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d), head);
+    size_t offset = 16 - (reinterpret_cast<uintptr_t>(d) & 15);
+    d += offset;
+    s += offset;
+    size -= offset;
+
+    for (; size >= 16; size -= 16, d += 16, s += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d), _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+    }
+
+    _mm_sfence();
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(end), tail);
+}
+
+KW_TARGET_AVX2 static void SetAvx2(void* dst, int value, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    __m256i fill = _mm256_set1_epi8(static_cast<char>(value));
+    char* end = d + size - 32;
+
+    for (; size > 128; size -= 128, d += 128)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), fill);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 32), fill);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 64), fill);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 96), fill);
+    }
+
+    for (; size > 32; size -= 32, d += 32)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), fill);
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(end), fill);
+}
+
+KW_TARGET_AVX2 static void SetStreamAvx2(void* dst, int value, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    __m256i fill = _mm256_set1_epi8(static_cast<char>(value));
+    char* end = d + size - 32;
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d), fill);
+    size_t offset = 32 - (reinterpret_cast<uintptr_t>(d) & 31);
+    d += offset;
+    size -= offset;
+
+    for (; size >= 32; size -= 32, d += 32)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(d), fill);
+    }
+
+    _mm_sfence();
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(end), fill);
+}
+
+KW_TARGET_AVX512 static void SetAvx512(void* dst, int value, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    __m512i fill = _mm512_set1_epi32(static_cast<int>(0x01010101u * static_cast<unsigned char>(value)));
+    char* end = d + size - 64;
+
+    for (; size > 256; size -= 256, d += 256)
+    {
+        _mm512_storeu_si512(d, fill);
+        _mm512_storeu_si512(d + 64, fill);
+        _mm512_storeu_si512(d + 128, fill);
+        _mm512_storeu_si512(d + 192, fill);
+    }
+
+    for (; size > 64; size -= 64, d += 64)
+    {
+        _mm512_storeu_si512(d, fill);
+    }
+
+    _mm512_storeu_si512(end, fill);
+}
+
+KW_TARGET_AVX512 static void SetStreamAvx512(void* dst, int value, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    __m512i fill = _mm512_set1_epi32(static_cast<int>(0x01010101u * static_cast<unsigned char>(value)));
+    char* end = d + size - 64;
+
+    _mm512_storeu_si512(d, fill);
+    size_t offset = 64 - (reinterpret_cast<uintptr_t>(d) & 63);
+    d += offset;
+    size -= offset;
+
+    for (; size >= 64; size -= 64, d += 64)
+    {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(d), fill);
+    }
+
+    _mm_sfence();
+
+    _mm512_storeu_si512(end, fill);
+}
+
+static void SetStreamSse2(void* dst, int value, size_t size)
+{
+    char* d = static_cast<char*>(dst);
+    __m128i fill = _mm_set1_epi8(static_cast<char>(value));
+    char* end = d + size - 16;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d), fill);
+    size_t offset = 16 - (reinterpret_cast<uintptr_t>(d) & 15);
+    d += offset;
+    size -= offset;
+
+    for (; size >= 16; size -= 16, d += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d), fill);
+    }
+
+    _mm_sfence();
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(end), fill);
+}
+
+KW_TARGET_AVX2 static int CompareAvx2(const void* lhs, const void* rhs, size_t size)
+{
+    const unsigned char* l = static_cast<const unsigned char*>(lhs);
+    const unsigned char* r = static_cast<const unsigned char*>(rhs);
+
+    if (size < 32)
+    {
+        return memcmp(lhs, rhs, size);
+    }
+
+    for (size_t i = 0; i < size; i += 32)
+    {
+        // The last vector is aligned to the end, overlapped bytes are known to be equal.
+        size_t offset = i + 32 <= size ? i : size - 32;
+
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l + offset));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r + offset));
+
+        unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+        if (mask != 0)
+        {
+            size_t index = offset + static_cast<size_t>(std::countr_zero(mask));
+            return static_cast<int>(l[index]) - static_cast<int>(r[index]);
+        }
+    }
+
+    return 0;
+}
+
+// Size-based dispatch. `VectorSize` is the smallest size the vector loops accept.
+template <size_t VectorSize, CopyFunction VectorCopy, CopyFunction StreamCopy>
+static void Copy(void* dst, const void* src, size_t size)
+{
+    if (size < VectorSize)
+    {
+        memcpy(dst, src, size);
+    }
+    else if (size >= s_nonTemporalThreshold)
+    {
+        StreamCopy(dst, src, size);
+    }
+    else if (s_hasErms && size >= s_ermsThreshold)
+    {
+        RepMovsb(dst, src, size);
+    }
+    else
+    {
+        VectorCopy(dst, src, size);
+    }
+}
+
+// Without AVX2 libc is used for everything except non-temporal copies.
+static void CopySse2(void* dst, const void* src, size_t size)
+{
+    if (size >= s_nonTemporalThreshold)
+    {
+        CopyStreamSse2(dst, src, size);
+    }
+    else if (s_hasErms && size >= s_ermsThreshold)
+    {
+        RepMovsb(dst, src, size);
+    }
+    else
+    {
+        memcpy(dst, src, size);
+    }
+}
+
+template <size_t VectorSize, SetFunction VectorSet, SetFunction StreamSet>
+static void Set(void* dst, int value, size_t size)
+{
+    if (size < VectorSize)
+    {
+        memset(dst, value, size);
+    }
+    else if (size >= s_nonTemporalThreshold)
+    {
+        StreamSet(dst, value, size);
+    }
+    else if (s_hasErms && size >= s_ermsThreshold)
+    {
+        RepStosb(dst, value, size);
+    }
+    else
+    {
+        VectorSet(dst, value, size);
+    }
+}
+
+static void SetSse2(void* dst, int value, size_t size)
+{
+    if (size >= s_nonTemporalThreshold)
+    {
+        SetStreamSse2(dst, value, size);
+    }
+    else if (s_hasErms && size >= s_ermsThreshold)
+    {
+        RepStosb(dst, value, size);
+    }
+    else
+    {
+        memset(dst, value, size);
+    }
+}
+
+static int CompareLibc(const void* lhs, const void* rhs, size_t size)
+{
+    return memcmp(lhs, rhs, size);
+}
+
+static void InitializeDispatch()
+{
+    unsigned registers[4];
+
+    Cpuid(0, 0, registers);
+    unsigned maxLeaf = registers[0];
+
+    bool isAmd = registers[1] == 0x68747541; // "Auth" of "AuthenticAMD".
+
+    bool hasAvx2 = false;
+    bool hasAvx512 = false;
+
+    if (maxLeaf >= 7)
+    {
+        Cpuid(1, 0, registers);
+        bool hasOsxsave = (registers[2] & (1u << 27)) != 0;
+        bool hasAvx = (registers[2] & (1u << 28)) != 0;
+
+        // The OS must save the upper halves of the vector registers on context switches.
+        uint64_t xcr0 = hasOsxsave ? GetXcr0() : 0;
+        bool hasAvxState = hasAvx && (xcr0 & 0x6) == 0x6;
+        bool hasAvx512State = hasAvxState && (xcr0 & 0xE0) == 0xE0;
+
+        Cpuid(7, 0, registers);
+        hasAvx2 = hasAvxState && (registers[1] & (1u << 5)) != 0;
+        hasAvx512 = hasAvx512State && (registers[1] & (1u << 16)) != 0;
+        s_hasErms = (registers[1] & (1u << 9)) != 0;
+    }
+
+    size_t cacheSize = 0;
+    if (isAmd)
+    {
+        Cpuid(0x80000000, 0, registers);
+        if (registers[0] >= 0x8000001D)
+        {
+            cacheSize = GetCacheSize(0x8000001D);
+        }
+    }
+    else if (maxLeaf >= 4)
+    {
+        cacheSize = GetCacheSize(4);
+    }
+
+    if (cacheSize != 0)
+    {
+        s_nonTemporalThreshold = cacheSize / 2;
+    }
+
+    // Thresholds are set above, before the functions that read them are published.
+    if (hasAvx512)
+    {
+        s_copyFunction.store(&Copy<64, &CopyAvx512, &CopyStreamAvx512>, std::memory_order_release);
+        s_setFunction.store(&Set<64, &SetAvx512, &SetStreamAvx512>, std::memory_order_release);
+        s_compareFunction.store(&CompareAvx2, std::memory_order_release);
+    }
+    else if (hasAvx2)
+    {
+        s_copyFunction.store(&Copy<32, &CopyAvx2, &CopyStreamAvx2>, std::memory_order_release);
+        s_setFunction.store(&Set<32, &SetAvx2, &SetStreamAvx2>, std::memory_order_release);
+        s_compareFunction.store(&CompareAvx2, std::memory_order_release);
+    }
+    else
+    {
+        s_copyFunction.store(&CopySse2, std::memory_order_release);
+        s_setFunction.store(&SetSse2, std::memory_order_release);
+        s_compareFunction.store(&CompareLibc, std::memory_order_release);
+    }
+}
+
+// Threads that call a resolver at the same time wait until the first one finishes the detection.
+static void InitializeDispatchOnce()
+{
+    static const bool initialized = (InitializeDispatch(), true);
+    (void)initialized;
+}
+
+static void ResolveCopy(void* dst, const void* src, size_t size)
+{
+    InitializeDispatchOnce();
+    s_copyFunction.load(std::memory_order_acquire)(dst, src, size);
+}
+
+static void ResolveSet(void* dst, int value, size_t size)
+{
+    InitializeDispatchOnce();
+    s_setFunction.load(std::memory_order_acquire)(dst, value, size);
+}
+
+static int ResolveCompare(const void* lhs, const void* rhs, size_t size)
+{
+    InitializeDispatchOnce();
+    return s_compareFunction.load(std::memory_order_acquire)(lhs, rhs, size);
+}
+
+#endif // KW_MEMORY_DISPATCH
+
 void* Memory::Malloc(size_t size, size_t alignment)
 {
     return _aligned_malloc(size, alignment);
 }
 
+void* Memory::Realloc(void* address, size_t size, size_t alignment)
+{
+    return _aligned_realloc(address, size, alignment);
+}
+
 void Memory::Free(void* address)
 {
     return _aligned_free(address);
@@ -18,22 +632,46 @@ void Memory::Free(void* address)
 
 void Memory::Memcpy(void* dst, const void* src, size_t size)
 {
+#ifdef KW_MEMORY_DISPATCH
+    s_copyFunction.load(std::memory_order_acquire)(dst, src, size);
+#else
     memcpy(dst, src, size);
+#endif // KW_MEMORY_DISPATCH
 }
 
 void Memory::Memmove(void* dst, const void* src, size_t size)
 {
+#ifdef KW_MEMORY_DISPATCH
+    const char* d = static_cast<const char*>(dst);
+    const char* s = static_cast<const char*>(src);
+
+    // Most moves in containers don't overlap, e.g. relocation to a new allocation. Overlapping ones go to libc.
+    if (d + size <= s || s + size <= d)
+    {
+        s_copyFunction.load(std::memory_order_acquire)(dst, src, size);
+        return;
+    }
+#endif // KW_MEMORY_DISPATCH
+
     memmove(dst, src, size);
 }
 
 int Memory::Memcmp(const void* lhs, const void* rhs, size_t size)
 {
+#ifdef KW_MEMORY_DISPATCH
+    return s_compareFunction.load(std::memory_order_acquire)(lhs, rhs, size);
+#else
     return memcmp(lhs, rhs, size);
+#endif // KW_MEMORY_DISPATCH
 }
 
 void Memory::Memset(void* dst, int value, size_t size)
 {
+#ifdef KW_MEMORY_DISPATCH
+    s_setFunction.load(std::memory_order_acquire)(dst, value, size);
+#else
     memset(dst, value, size);
+#endif // KW_MEMORY_DISPATCH
 }
 
 } // namespace kw
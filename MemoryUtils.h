@@ -8,19 +8,27 @@ namespace kw::MemoryUtils
 // TODO: Description.
 void* Malloc(size_t Size, size_t Alignment = 1);
 
+// Resize the given block allocated with `Malloc` to the given size, preserving its contents. The block is grown
+// in-place when possible, otherwise its bytes are copied to a new block. Must be called with the same alignment that
+// was used for the allocation. If the given address is null, behaves like `Malloc`.
+void* Realloc(void* Address, size_t Size, size_t Alignment = 1);
+
 // TODO: Description.
 void Free(void* Address);
 
-// TODO: Description.
+// Copy the given number of bytes between two non-overlapping blocks. The implementation is chosen on the first call
+// based on CPU features (AVX-512, AVX2, ERMS) and then by size. Copies larger than half of the last level cache use
+// non-temporal stores, so they don't evict the rest of the cache, but the copied data is not cached either.
 void Memcpy(void* Dst, const void* Src, size_t Size);
 
-// TODO: Description.
+// Copy the given number of bytes between two possibly overlapping blocks. Non-overlapping blocks are copied like
+// with `Memcpy`.
 void Memmove(void* Dst, const void* Src, size_t Size);
 
-// TODO: Description.
+// Compare the given number of bytes as unsigned chars. Return a negative value, zero, or a positive value.
 int Memcmp(const void* Lhs, const void* Rhs, size_t Size);
 
-// TODO: Description.
+// Fill the given number of bytes with the given value. Dispatched like `Memcpy`.
 void Memset(void* Dst, int Value, size_t Size);
 
 } // namespace kw::MemoryUtils
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "HashMap.h"
+#include "NodeHashTable.h"
+
+namespace kw
+{
+
+// Same as `HashMap`, but elements never move, so pointers and references to them stay valid until they're erased.
+// The probing table stores pointers to elements allocated from a pool, see `NodeHashTable`.
+template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>>
+using NodeHashMap = HashMap<Key, Value, KeyHash, KeyEqual, Allocator, NodeHashLayout<>>;
+
+} // namespace kw
@@ -0,0 +1,736 @@
+#pragma once
+
+#include "HashTraits.h"
+#include "Pair.h"
+#include "SwissHashTable.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <new>
+
+namespace kw
+{
+
+template<class Traits, class Layout>
+class NodeHashTable;
+
+namespace HashDetails
+{
+
+// Traits of the probing table of `NodeHashTable`, which stores pointers to the elements instead of the elements.
+template<class Traits>
+struct NodeHashTraits
+{
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType*;
+	using ElementHashType = typename Traits::ElementHashType;
+	using ElementEqualType = typename Traits::ElementEqualType;
+	using AllocatorType = typename RebindAllocator<typename Traits::AllocatorType, ElementType>::Type;
+
+	static constexpr bool IsUnique = Traits::IsUnique;
+	static constexpr bool IsTransparent = Traits::IsTransparent;
+
+	static const KeyType& GetKey(const ElementType& Element);
+
+	template<class K>
+	static size_t GetHash(const K& InKey);
+
+	template<class K>
+	static bool IsEqual(const KeyType& Lhs, const K& Rhs);
+};
+
+} // namespace HashDetails
+
+// Bidirectional iterator over elements of `NodeHashTable`. Iterates over the probing table and dereferences the
+// pointers it stores.
+template<class T, class InnerIterator, class MutableInnerIterator>
+class NodeHashIterator
+{
+public:
+	using ValueType = T;
+
+	NodeHashIterator() = default;
+	explicit NodeHashIterator(InnerIterator InPosition);
+	NodeHashIterator(const NodeHashIterator<TypeTraits::RemoveConst<T>, MutableInnerIterator, MutableInnerIterator>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	NodeHashIterator& operator++();
+	NodeHashIterator operator++(int);
+
+	NodeHashIterator& operator--();
+	NodeHashIterator operator--(int);
+
+	friend bool operator==(const NodeHashIterator& Lhs, const NodeHashIterator& Rhs) = default;
+
+private:
+	template<class U, class V, class W>
+	friend class NodeHashIterator;
+
+	template<class Traits, class Layout>
+	friend class NodeHashTable;
+
+	InnerIterator mPosition;
+};
+
+// Hash table with stable elements. Elements are allocated from a pool of chunks, and the probing table of `Layout`
+// only stores pointers to them. Rehashing and erasure move the pointers, but never the elements, so pointers and
+// references to elements stay valid until the elements are erased. Iterators are invalidated as usual. The probing
+// table stays dense, e.g. one control byte and one pointer per slot with `SwissHashLayout`, but every key comparison
+// and every rehashed element costs an extra indirection. Chunks are allocated with the container's allocator and
+// grow geometrically. Erased elements are reused before new chunks are allocated. `Layout` must be either
+// `RobinHoodHashLayout` or `SwissHashLayout`. See `HashBase` for the interface.
+template<class Traits, class Layout>
+class NodeHashTable : protected Traits::AllocatorType
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	using InnerTraits = HashDetails::NodeHashTraits<Traits>;
+	using InnerTable = typename Layout::template Table<InnerTraits>;
+
+	using Iterator = NodeHashIterator<ElementType, typename InnerTable::Iterator, typename InnerTable::Iterator>;
+	using ConstIterator = NodeHashIterator<const ElementType, typename InnerTable::ConstIterator, typename InnerTable::Iterator>;
+
+	explicit NodeHashTable(const AllocatorType& InAllocator);
+	NodeHashTable(const NodeHashTable& Other);
+	NodeHashTable(NodeHashTable&& Other);
+	~NodeHashTable();
+
+	template<class OtherTraits>
+	NodeHashTable(const NodeHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator);
+
+	NodeHashTable& operator=(const NodeHashTable& Other);
+	NodeHashTable& operator=(NodeHashTable&& Other);
+
+	// Reserve both the probing table and the pool.
+	void Reserve(size_t Capacity);
+
+	// Keep the probing table and the last allocated chunk of the pool.
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+
+	// Only the probing table shrinks, because elements never move. An empty table with zero capacity frees the pool.
+	void Rehash(size_t Capacity);
+
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+	size_t FindRunEnd(size_t Index) const;
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+	bool IsFull() const;
+	void Prefetch(size_t Hash) const;
+	size_t EraseIndex(size_t Index);
+	void EraseRun(size_t Index, size_t Count);
+	size_t SkipEmpty(size_t Index) const;
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits, class OtherLayout>
+	friend class NodeHashTable;
+
+	// Storage of a single element. Free slots link to the next free slot instead. The first slot of every chunk links
+	// to the previously allocated chunk.
+	union Slot
+	{
+		Slot() {}
+		~Slot() {}
+
+		ElementType Element;
+		Slot* Next;
+	};
+
+	// Number of slots in the first chunk. Every following chunk is as large as all the previous ones together.
+	static constexpr size_t MinChunkSize = 16;
+
+	using SlotAllocator = typename HashDetails::RebindAllocator<AllocatorType, Slot>::Type;
+
+	// Return a slot for a new element. The caller constructs the element.
+	ElementType* AllocateSlot();
+
+	// Return the slot of a destroyed element to the pool.
+	void DeallocateSlot(ElementType* Element);
+
+	// Allocate a chunk with the given number of slots. Unused slots of the previous chunk join the free list.
+	void AllocateChunk(size_t SlotCount);
+
+	void DeallocateChunks();
+
+	// Copy the elements of the given table, which has the same probing table as this one.
+	template<class OtherTable>
+	void CopyElements(const OtherTable& Other);
+
+	void DestroyElements();
+
+	InnerTable mTable;
+
+	// Last allocated chunk, whose slots are handed out in order from `mNextSlot` to `mChunkEnd`.
+	Slot* mChunks;
+	Slot* mNextSlot;
+	Slot* mChunkEnd;
+
+	// Slots of erased elements.
+	Slot* mFreeSlots;
+
+	// Number of slots in all chunks.
+	size_t mPoolCapacity;
+};
+
+// Layout of hash containers that uses `NodeHashTable` on top of the given layout. Use it when elements are referenced
+// from elsewhere, or when they are expensive to move. See `NodeHashMap`.
+template<class Layout = SwissHashLayout>
+struct NodeHashLayout
+{
+	template<class Traits>
+	using Table = NodeHashTable<Traits, Layout>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace HashDetails
+{
+
+template<class Traits>
+const typename NodeHashTraits<Traits>::KeyType& NodeHashTraits<Traits>::GetKey(const ElementType& Element)
+{
+	return Traits::GetKey(*Element);
+}
+
+template<class Traits>
+template<class K>
+size_t NodeHashTraits<Traits>::GetHash(const K& InKey)
+{
+	return Traits::GetHash(InKey);
+}
+
+template<class Traits>
+template<class K>
+bool NodeHashTraits<Traits>::IsEqual(const KeyType& Lhs, const K& Rhs)
+{
+	return Traits::IsEqual(Lhs, Rhs);
+}
+
+} // namespace HashDetails
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator>::NodeHashIterator(InnerIterator InPosition)
+	: mPosition(InPosition)
+{
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator>::NodeHashIterator(const NodeHashIterator<TypeTraits::RemoveConst<T>, MutableInnerIterator, MutableInnerIterator>& Other)
+	: mPosition(Other.mPosition)
+{
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+typename NodeHashIterator<T, InnerIterator, MutableInnerIterator>::ValueType& NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator*() const
+{
+	return **mPosition;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+typename NodeHashIterator<T, InnerIterator, MutableInnerIterator>::ValueType* NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator->() const
+{
+	return *mPosition;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator>& NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator++()
+{
+	++mPosition;
+	return *this;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator> NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator++(int)
+{
+	NodeHashIterator Result(*this);
+	++mPosition;
+	return Result;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator>& NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator--()
+{
+	--mPosition;
+	return *this;
+}
+
+template<class T, class InnerIterator, class MutableInnerIterator>
+NodeHashIterator<T, InnerIterator, MutableInnerIterator> NodeHashIterator<T, InnerIterator, MutableInnerIterator>::operator--(int)
+{
+	NodeHashIterator Result(*this);
+	--mPosition;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>::NodeHashTable(const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mTable(typename InnerTraits::AllocatorType(InAllocator))
+	, mChunks(nullptr)
+	, mNextSlot(nullptr)
+	, mChunkEnd(nullptr)
+	, mFreeSlots(nullptr)
+	, mPoolCapacity(0)
+{
+}
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>::NodeHashTable(const NodeHashTable& Other)
+	: AllocatorType(Other.GetAllocator())
+	, mTable(Other.mTable)
+	, mChunks(nullptr)
+	, mNextSlot(nullptr)
+	, mChunkEnd(nullptr)
+	, mFreeSlots(nullptr)
+	, mPoolCapacity(0)
+{
+	CopyElements(Other);
+}
+
+template<class Traits, class Layout>
+template<class OtherTraits>
+NodeHashTable<Traits, Layout>::NodeHashTable(const NodeHashTable<OtherTraits, Layout>& Other, const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mTable(Other.mTable, typename InnerTraits::AllocatorType(InAllocator))
+	, mChunks(nullptr)
+	, mNextSlot(nullptr)
+	, mChunkEnd(nullptr)
+	, mFreeSlots(nullptr)
+	, mPoolCapacity(0)
+{
+	CopyElements(Other);
+}
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>::NodeHashTable(NodeHashTable&& Other)
+	: AllocatorType(static_cast<AllocatorType&&>(Other))
+	, mTable(static_cast<InnerTable&&>(Other.mTable))
+	, mChunks(Other.mChunks)
+	, mNextSlot(Other.mNextSlot)
+	, mChunkEnd(Other.mChunkEnd)
+	, mFreeSlots(Other.mFreeSlots)
+	, mPoolCapacity(Other.mPoolCapacity)
+{
+	Other.mChunks = nullptr;
+	Other.mNextSlot = nullptr;
+	Other.mChunkEnd = nullptr;
+	Other.mFreeSlots = nullptr;
+	Other.mPoolCapacity = 0;
+}
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>::~NodeHashTable()
+{
+	DestroyElements();
+	DeallocateChunks();
+}
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>& NodeHashTable<Traits, Layout>::operator=(const NodeHashTable& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateChunks();
+
+		mTable = Other.mTable;
+
+		CopyElements(Other);
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+NodeHashTable<Traits, Layout>& NodeHashTable<Traits, Layout>::operator=(NodeHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateChunks();
+
+		static_cast<AllocatorType&>(*this) = static_cast<AllocatorType&&>(Other);
+
+		mTable = static_cast<InnerTable&&>(Other.mTable);
+		mChunks = Other.mChunks;
+		mNextSlot = Other.mNextSlot;
+		mChunkEnd = Other.mChunkEnd;
+		mFreeSlots = Other.mFreeSlots;
+		mPoolCapacity = Other.mPoolCapacity;
+
+		Other.mChunks = nullptr;
+		Other.mNextSlot = nullptr;
+		Other.mChunkEnd = nullptr;
+		Other.mFreeSlots = nullptr;
+		Other.mPoolCapacity = 0;
+	}
+	return *this;
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::Reserve(size_t Capacity)
+{
+	mTable.Reserve(Capacity);
+
+	if (Capacity > mPoolCapacity)
+	{
+		AllocateChunk(Capacity - mPoolCapacity);
+	}
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::Clear()
+{
+	DestroyElements();
+	mTable.Clear();
+
+	// Chunks grow geometrically, so the last one holds at least half of the slots.
+	if (mChunks != nullptr)
+	{
+		Slot* LastChunk = mChunks;
+		Slot* LastChunkEnd = mChunkEnd;
+		size_t LastChunkSize = static_cast<size_t>(mChunkEnd - mChunks) - 1;
+
+		mChunks = mChunks->Next;
+		DeallocateChunks();
+
+		LastChunk->Next = nullptr;
+
+		mChunks = LastChunk;
+		mNextSlot = LastChunk + 1;
+		mChunkEnd = LastChunkEnd;
+		mPoolCapacity = LastChunkSize;
+	}
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::GetSize() const
+{
+	return mTable.GetSize();
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::GetCapacity() const
+{
+	return mTable.GetCapacity();
+}
+
+template<class Traits, class Layout>
+const typename NodeHashTable<Traits, Layout>::AllocatorType& NodeHashTable<Traits, Layout>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Traits, class Layout>
+float NodeHashTable<Traits, Layout>::GetLoadFactor() const
+{
+	return mTable.GetLoadFactor();
+}
+
+template<class Traits, class Layout>
+float NodeHashTable<Traits, Layout>::GetMaxLoadFactor() const
+{
+	return mTable.GetMaxLoadFactor();
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::SetMaxLoadFactor(float LoadFactor)
+{
+	mTable.SetMaxLoadFactor(LoadFactor);
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::Rehash(size_t Capacity)
+{
+	mTable.Rehash(Capacity);
+
+	if (Capacity == 0 && mTable.GetSize() == 0)
+	{
+		DeallocateChunks();
+	}
+}
+
+template<class Traits, class Layout>
+template<class K>
+size_t NodeHashTable<Traits, Layout>::FindIndex(const K& InKey, size_t Hash) const
+{
+	return mTable.FindIndex(InKey, Hash);
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::FindRunEnd(size_t Index) const
+{
+	return mTable.FindRunEnd(Index);
+}
+
+template<class Traits, class Layout>
+Pair<size_t, bool> NodeHashTable<Traits, Layout>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	Pair<size_t, bool> Result = mTable.FindOrPrepareInsert(InKey, Hash);
+	if (Result.Value)
+	{
+		new (&mTable.GetElement(Result.Key)) ElementType*(AllocateSlot());
+	}
+
+	return Result;
+}
+
+template<class Traits, class Layout>
+bool NodeHashTable<Traits, Layout>::IsFull() const
+{
+	return mTable.IsFull();
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::Prefetch(size_t Hash) const
+{
+	mTable.Prefetch(Hash);
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::EraseIndex(size_t Index)
+{
+	// The probing table may compare the key of the erased element with its neighbours, so destroy it afterwards.
+	ElementType* Element = mTable.GetElement(Index);
+	size_t NextIndex = mTable.EraseIndex(Index);
+
+	Element->~ElementType();
+	DeallocateSlot(Element);
+
+	return NextIndex;
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::EraseRun(size_t Index, size_t Count)
+{
+	// The probing table doesn't compare keys of the erased run, so the elements can be destroyed first.
+	for (size_t i = Index; i < Index + Count; i++)
+	{
+		ElementType* Element = mTable.GetElement(i);
+		Element->~ElementType();
+		DeallocateSlot(Element);
+	}
+
+	mTable.EraseRun(Index, Count);
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::SkipEmpty(size_t Index) const
+{
+	return mTable.SkipEmpty(Index);
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::GetEndIndex() const
+{
+	return mTable.GetEndIndex();
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ElementType& NodeHashTable<Traits, Layout>::GetElement(size_t Index)
+{
+	return *mTable.GetElement(Index);
+}
+
+template<class Traits, class Layout>
+const typename NodeHashTable<Traits, Layout>::ElementType& NodeHashTable<Traits, Layout>::GetElement(size_t Index) const
+{
+	return *mTable.GetElement(Index);
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::Iterator NodeHashTable<Traits, Layout>::MakeIterator(size_t Index)
+{
+	return Iterator(mTable.MakeIterator(Index));
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ConstIterator NodeHashTable<Traits, Layout>::MakeIterator(size_t Index) const
+{
+	return ConstIterator(mTable.MakeIterator(Index));
+}
+
+template<class Traits, class Layout>
+size_t NodeHashTable<Traits, Layout>::GetIndex(ConstIterator Position) const
+{
+	return mTable.GetIndex(Position.mPosition);
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::Iterator NodeHashTable<Traits, Layout>::GetBegin()
+{
+	return Iterator(mTable.GetBegin());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ConstIterator NodeHashTable<Traits, Layout>::GetBegin() const
+{
+	return ConstIterator(mTable.GetBegin());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::Iterator NodeHashTable<Traits, Layout>::GetEnd()
+{
+	return Iterator(mTable.GetEnd());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ConstIterator NodeHashTable<Traits, Layout>::GetEnd() const
+{
+	return ConstIterator(mTable.GetEnd());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::Iterator NodeHashTable<Traits, Layout>::GetLast()
+{
+	return Iterator(mTable.GetLast());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ConstIterator NodeHashTable<Traits, Layout>::GetLast() const
+{
+	return ConstIterator(mTable.GetLast());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::Iterator NodeHashTable<Traits, Layout>::GetBeforeBegin()
+{
+	return Iterator(mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ConstIterator NodeHashTable<Traits, Layout>::GetBeforeBegin() const
+{
+	return ConstIterator(mTable.GetBeforeBegin());
+}
+
+template<class Traits, class Layout>
+typename NodeHashTable<Traits, Layout>::ElementType* NodeHashTable<Traits, Layout>::AllocateSlot()
+{
+	if (mFreeSlots != nullptr)
+	{
+		Slot* Result = mFreeSlots;
+		mFreeSlots = Result->Next;
+		return &Result->Element;
+	}
+
+	if (mNextSlot == mChunkEnd)
+	{
+		AllocateChunk(mPoolCapacity < MinChunkSize ? MinChunkSize : mPoolCapacity);
+	}
+
+	return &(mNextSlot++)->Element;
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::DeallocateSlot(ElementType* Element)
+{
+	// The element is the first member of its slot, so they share the address.
+	Slot* FreeSlot = reinterpret_cast<Slot*>(Element);
+	FreeSlot->Next = mFreeSlots;
+	mFreeSlots = FreeSlot;
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::AllocateChunk(size_t SlotCount)
+{
+	for (; mNextSlot != mChunkEnd; mNextSlot++)
+	{
+		mNextSlot->Next = mFreeSlots;
+		mFreeSlots = mNextSlot;
+	}
+
+	Slot* Chunk = SlotAllocator(GetAllocator()).Allocate(SlotCount + 1);
+	Chunk->Next = mChunks;
+
+	mChunks = Chunk;
+	mNextSlot = Chunk + 1;
+	mChunkEnd = Chunk + 1 + SlotCount;
+	mPoolCapacity += SlotCount;
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::DeallocateChunks()
+{
+	while (mChunks != nullptr)
+	{
+		Slot* Chunk = mChunks;
+		mChunks = Chunk->Next;
+		SlotAllocator(GetAllocator()).Deallocate(Chunk);
+	}
+
+	mNextSlot = nullptr;
+	mChunkEnd = nullptr;
+	mFreeSlots = nullptr;
+	mPoolCapacity = 0;
+}
+
+template<class Traits, class Layout>
+template<class OtherTable>
+void NodeHashTable<Traits, Layout>::CopyElements(const OtherTable& Other)
+{
+	// The probing table is a copy of the other one, so only the pointers need to be replaced with copies of elements.
+	size_t Size = Other.GetSize();
+	if (Size > 0)
+	{
+		AllocateChunk(Size);
+
+		for (size_t i = mTable.SkipEmpty(0); i != mTable.GetEndIndex(); i = mTable.SkipEmpty(i + 1))
+		{
+			ElementType* Element = &(mNextSlot++)->Element;
+			new (Element) ElementType(*Other.mTable.GetElement(i));
+			mTable.GetElement(i) = Element;
+		}
+	}
+}
+
+template<class Traits, class Layout>
+void NodeHashTable<Traits, Layout>::DestroyElements()
+{
+	if constexpr (!TypeTraits::IsTriviallyDestructible<ElementType>)
+	{
+		if (mTable.GetSize() == 0)
+		{
+			return;
+		}
+
+		for (size_t i = mTable.SkipEmpty(0); i != mTable.GetEndIndex(); i = mTable.SkipEmpty(i + 1))
+		{
+			mTable.GetElement(i)->~ElementType();
+		}
+	}
+}
+
+} // namespace kw
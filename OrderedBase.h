@@ -1,46 +1,167 @@
 #pragma once
 
+#include "Assert.h"
 #include "Concepts.h"
+#include "ContainerUtils.h"
+#include "HashTraits.h"
 #include "Iterators.h"
+#include "Memory.h"
 #include "Pair.h"
+#include "TypeTraits.h"
+#include "Utility.h"
 
+#include <cstdint>
 #include <initializer_list>
+#include <new>
 
 namespace kw
 {
 
-// TODO: Description
-template<class Key, class ElementType, class ElementLessThan, class Allocator, bool IsUniqueKeys>
-class OrderedBase
+// Specifies whether keys of type K can be looked up in ordered containers with the given comparator as they are, without
+// conversion to the key type.
+template<class K, class KeyType, class ElementLessThan>
+concept OrderedLookupKey = Transparent<ElementLessThan> &&
+                           Invocable<const ElementLessThan&, const KeyType&, const K&> &&
+                           Invocable<const ElementLessThan&, const K&, const KeyType&>;
+
+namespace OrderedDetails
+{
+
+// Header of leaf and inner nodes of `OrderedBase`.
+struct Node
+{
+	struct Node* Parent;
+
+	// The number of elements in a leaf, or the number of keys in an inner node, which has one more child.
+	uint32_t Count;
+
+	bool IsLeaf;
+};
+
+// Leaves hold the elements in order and are linked to their neighbours, so iteration never goes up the tree.
+template<class T, size_t Capacity>
+struct LeafNode : Node
+{
+	T* GetElements();
+	const T* GetElements() const;
+
+	LeafNode* Previous;
+	LeafNode* Next;
+
+	alignas(T) unsigned char Storage[sizeof(T) * Capacity];
+};
+
+// Inner nodes hold copies of keys that route lookups to their children. All keys in the subtree of a child are not
+// greater than the key that follows the child, and not less than the key before it.
+template<class Key, size_t Capacity>
+struct InnerNode : Node
+{
+	Key* GetKeys();
+	const Key* GetKeys() const;
+
+	Node* Children[Capacity + 1];
+
+	alignas(Key) unsigned char Storage[sizeof(Key) * Capacity];
+};
+
+// Relocate the given number of objects from the source to the destination. The ranges may overlap.
+template<class T>
+void Relocate(T* Destination, T* Source, size_t Count);
+
+} // namespace OrderedDetails
+
+// Bidirectional iterator over elements of `OrderedBase`. Moves between leaves by their links.
+template<class T, class Leaf>
+class OrderedIterator
+{
+public:
+	using ValueType = T;
+
+	OrderedIterator() = default;
+	OrderedIterator(Leaf* InLeaf, size_t InIndex);
+	OrderedIterator(const OrderedIterator<TypeTraits::RemoveConst<T>, Leaf>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	OrderedIterator& operator++();
+	OrderedIterator operator++(int);
+
+	OrderedIterator& operator--();
+	OrderedIterator operator--(int);
+
+	friend bool operator==(const OrderedIterator& Lhs, const OrderedIterator& Rhs)
+	{
+		return Lhs.mLeaf == Rhs.mLeaf && Lhs.mIndex == Rhs.mIndex;
+	}
+
+private:
+	template<class U, class V>
+	friend class OrderedIterator;
+
+	template<class, class, class, class, bool>
+	friend class OrderedBase;
+
+	Leaf* mLeaf;
+
+	// The end iterator points past the last element of the last leaf. The iterator before the first element has the
+	// index that wraps around to zero when incremented.
+	size_t mIndex;
+};
+
+// Base of all ordered containers: a B+-tree. Elements are stored in leaves of about `NodeSize` bytes each, in order,
+// and inner nodes of the same size hold copies of keys and pointers to dozens of children, so a lookup in a tree of
+// millions of elements visits a handful of nodes, and iteration reads leaves one after another. Insertion and erasure
+// invalidate iterators, pointers, and references to elements, since elements move between leaves.
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+class OrderedBase : protected Allocator
 {
 public:
 	using KeyType = Key;
-	using ElementType = ElementType;
+	using ElementType = T;
 	using ElementLessThanType = ElementLessThan;
 	using AllocatorType = Allocator;
 
-	using Iterator = RandomAccessIterator<ElementType>;
-	using ConstIterator = RandomAccessIterator<const ElementType>;
+	// Nodes take eight cache lines. A binary search in a node touches only three or four of them, so lookups cost about
+	// as much as with four times smaller nodes per level, but the tree has half as many levels. Larger nodes make
+	// insertion and erasure shift more elements without making lookups faster.
+	static constexpr size_t NodeSize = 512;
+
+	// Nodes hold at least 4 keys or elements even if they're large, so the tree keeps branching.
+	static constexpr size_t LeafCapacity = (NodeSize - 32) / sizeof(ElementType) > 4 ? (NodeSize - 32) / sizeof(ElementType) : 4;
+	static constexpr size_t InnerCapacity = (NodeSize - 24) / (sizeof(KeyType) + sizeof(void*)) > 4 ? (NodeSize - 24) / (sizeof(KeyType) + sizeof(void*)) : 4;
+
+private:
+	using LeafType = OrderedDetails::LeafNode<ElementType, LeafCapacity>;
+	using InnerType = OrderedDetails::InnerNode<KeyType, InnerCapacity>;
+	using NodeType = OrderedDetails::Node;
+
+public:
+	using Iterator = OrderedIterator<ElementType, LeafType>;
+	using ConstIterator = OrderedIterator<const ElementType, LeafType>;
 	using ReverseIterator = ::kw::ReverseIterator<Iterator>;
 	using ConstReverseIterator = ::kw::ReverseIterator<ConstIterator>;
 
 	// Constructs an empty container.
-	OrderedBase(const AllocatorType& InAllocator = AllocatorType());
+	OrderedBase(const Allocator& InAllocator = Allocator());
 
 	// Constructs a container from the given list.
-	OrderedBase(std::initializer_list<ElementType> List, const AllocatorType& InAllocator = AllocatorType());
+	OrderedBase(std::initializer_list<ElementType> List, const Allocator& InAllocator = Allocator());
 
 	// Constructs a container from the given container or view.
 	template<ForwardIterable<ElementType> Container>
-	OrderedBase(const Container& InContainer, const AllocatorType& InAllocator = AllocatorType());
+	OrderedBase(const Container& InContainer, const Allocator& InAllocator = Allocator());
 
 	// Constructs a container from the given range of elements.
 	template<ForwardIterator<ElementType> InIterator>
-	OrderedBase(InIterator Begin, InIterator End, const AllocatorType& InAllocator = AllocatorType());
+	OrderedBase(InIterator Begin, InIterator End, const Allocator& InAllocator = Allocator());
+
+	// Constructs a copy of the given container.
+	OrderedBase(const OrderedBase& Other);
 
 	// Constructs a copy of the given container.
 	template<class AnotherAllocator>
-	OrderedBase(const OrderedBase<KeyType, ElementType, ElementLessThanType, AnotherAllocator, IsUniqueKeys>& Other, const AllocatorType& InAllocator = AllocatorType());
+	OrderedBase(const OrderedBase<KeyType, ElementType, ElementLessThanType, AnotherAllocator, IsUniqueKeys>& Other, const Allocator& InAllocator = Allocator());
 
 	// Constructs a copy of the given container using move semantics.
 	OrderedBase(OrderedBase&& Other);
@@ -57,17 +178,13 @@ public:
 	// Replaces the contents of this container with the given container's elements using move semantics.
 	OrderedBase& operator=(OrderedBase&& Other);
 
-	// Allocate at least the given number of elements in the container.
-	// If the current capacity is already equal or greater, the function does nothing.
-	//void Reserve(size_t Capacity);
-
 	// Clear the container.
 	void Clear();
 
 	// Insert the given element into the container. If an element with the same key already exists,
 	// return its iterator and false. Otherwise return an iterator to the inserted element and true.
-	Pair<Iterator, bool> Insert(const ElementType& Element);
-	Pair<Iterator, bool> Insert(ElementType&& Element);
+	Pair<Iterator, bool> Insert(const ElementType& InElement);
+	Pair<Iterator, bool> Insert(ElementType&& InElement);
 
 	// Insert all elements of the given list into the container. If any keys in the given list already
 	// exist in this container, they are ignored.
@@ -90,24 +207,58 @@ public:
 	Pair<Iterator, bool> Emplace(InArgs&&... Args);
 
 	// Remove the given element from the container. Iterator must be valid and dereferenceable.
-	Iterator Erase(ConstIterator Iterator);
+	// Return an iterator to the element that follows the removed one.
+	Iterator Erase(ConstIterator Position);
 
 	// Remove an element with the given key from the container. Return how many elements were removed.
-	size_t Erase(const KeyType& Key);
+	size_t Erase(const KeyType& InKey);
 
 	// Return the number of elements with the given key.
-	size_t Count(const KeyType& Key) const;
+	size_t Count(const KeyType& InKey) const;
 
 	// Return an element with the given key. If such element doesn't exist, return end iterator.
-	Iterator Find(const KeyType& Key);
-	ConstIterator Find(const KeyType& Key) const;
+	Iterator Find(const KeyType& InKey);
+	ConstIterator Find(const KeyType& InKey) const;
 
 	// Return a range of elements with the given key. If no such element exists, return a pair of end iterators.
-	Pair<Iterator, Iterator> FindRange(const KeyType& Key);
-	Pair<ConstIterator, ConstIterator> FindRange(const KeyType& Key) const;
+	Pair<Iterator, Iterator> FindRange(const KeyType& InKey);
+	Pair<ConstIterator, ConstIterator> FindRange(const KeyType& InKey) const;
+
+	// Return the first element with a key that is not less than the given key, or the end iterator.
+	Iterator LowerBound(const KeyType& InKey);
+	ConstIterator LowerBound(const KeyType& InKey) const;
+
+	// Return the first element with a key that is greater than the given key, or the end iterator.
+	Iterator UpperBound(const KeyType& InKey);
+	ConstIterator UpperBound(const KeyType& InKey) const;
 
 	// Return whether an element with the given key exists in the container.
-	bool Contains(const KeyType& Key) const;
+	bool Contains(const KeyType& InKey) const;
+
+	// Overloads of the functions above for keys of other types, e.g. `StringView` for `String` keys. They don't
+	// construct a temporary key. Only available when the comparator is transparent.
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	size_t Erase(const K& InKey);
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	size_t Count(const K& InKey) const;
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	Iterator Find(const K& InKey);
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	ConstIterator Find(const K& InKey) const;
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	Pair<Iterator, Iterator> FindRange(const K& InKey);
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	Pair<ConstIterator, ConstIterator> FindRange(const K& InKey) const;
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	Iterator LowerBound(const K& InKey);
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	ConstIterator LowerBound(const K& InKey) const;
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	Iterator UpperBound(const K& InKey);
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	ConstIterator UpperBound(const K& InKey) const;
+	template<OrderedLookupKey<Key, ElementLessThan> K>
+	bool Contains(const K& InKey) const;
 
 	// Return an iterator to the beginning.
 	Iterator GetBegin();
@@ -141,11 +292,1298 @@ public:
 	// Return how many elements are stored in the container.
 	size_t GetSize() const;
 
-	// Return how many elements are allocated in the container.
-	//size_t GetCapacity() const;
-
 	// Return the associated allocator.
-	const AllocatorType& GetAllocator() const;
+	const Allocator& GetAllocator() const;
+
+protected:
+	template<class, class, class, class, bool>
+	friend class OrderedBase;
+
+	using LeafAllocator = typename HashDetails::RebindAllocator<Allocator, LeafType>::Type;
+	using InnerAllocator = typename HashDetails::RebindAllocator<Allocator, InnerType>::Type;
+
+	// Nodes other than the root don't get less than half full. Erasure moves elements from a neighbour, or merges with
+	// it when both are at most half full.
+	static constexpr size_t MinLeafCount = LeafCapacity / 2;
+	static constexpr size_t MinInnerCount = InnerCapacity / 2;
+
+	// Return the key of an element, or the given key itself.
+	template<class U>
+	static const KeyType& GetKey(const U& Value);
+
+	// Return the index of the first value that is not less than, or greater than, the given key.
+	template<class U, class K>
+	static size_t FindLowerBoundIndex(const U* Values, size_t ValueCount, const K& InKey);
+	template<class U, class K>
+	static size_t FindUpperBoundIndex(const U* Values, size_t ValueCount, const K& InKey);
+
+	template<class K>
+	Iterator FindLowerBound(const K& InKey) const;
+	template<class K>
+	Iterator FindUpperBound(const K& InKey) const;
+	template<class K>
+	Iterator FindElement(const K& InKey) const;
+	template<class K>
+	size_t CountElements(const K& InKey) const;
+	template<class K>
+	Pair<Iterator, Iterator> FindElementRange(const K& InKey) const;
+	template<class K>
+	size_t EraseElements(const K& InKey);
+
+	// Insert the given element, or return the element with the same key in unique key containers.
+	template<class U>
+	Pair<Iterator, bool> InsertElement(U&& InElement);
+
+	// Split the given full leaf in two before an insertion at the given index. Update the leaf and the index to where
+	// the element with the given key must be inserted.
+	void SplitLeaf(LeafType*& Leaf, size_t& Index, const KeyType& InKey);
+
+	// Insert the given key and the right node after the left node into the left node's parent, splitting it if full.
+	void InsertIntoParent(NodeType* Left, KeyType&& Separator, NodeType* Right);
+
+	// Insert the given key and the child that follows it at the given key index of the given inner node.
+	static void InsertIntoInner(InnerType* Node, size_t Index, KeyType&& Separator, NodeType* Child);
+
+	// Remove the key at the given index and the child that follows it from the given inner node.
+	static void RemoveFromInner(InnerType* Node, size_t Index);
+
+	// Erase the element at the given position, and rebalance the tree. Return the position of the next element.
+	Iterator EraseAt(LeafType* Leaf, size_t Index);
+
+	// Move elements from a neighbour into the given inner node, or merge it with a neighbour, while it's underfull.
+	void RebalanceInner(InnerType* Node);
+
+	// Return the index of the given child in its parent.
+	static size_t FindChildIndex(const InnerType* Parent, const NodeType* Child);
+
+	// Return the iterator to the next element if the given position is past the end of a leaf that isn't the last.
+	static Iterator Normalize(LeafType* Leaf, size_t Index);
+
+	// Copy the given subtree with the given parent. Leaves are linked after `mLast`.
+	NodeType* CopyNode(const NodeType* Source, InnerType* Parent);
+
+	void DestroyNode(NodeType* Node);
+
+	LeafType* AllocateLeaf();
+	InnerType* AllocateInner();
+
+	NodeType* mRoot;
+	LeafType* mFirst;
+	LeafType* mLast;
+	size_t mSize;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OrderedDetails
+{
+
+template<class T, size_t Capacity>
+T* LeafNode<T, Capacity>::GetElements()
+{
+	return reinterpret_cast<T*>(Storage);
+}
+
+template<class T, size_t Capacity>
+const T* LeafNode<T, Capacity>::GetElements() const
+{
+	return reinterpret_cast<const T*>(Storage);
+}
+
+template<class Key, size_t Capacity>
+Key* InnerNode<Key, Capacity>::GetKeys()
+{
+	return reinterpret_cast<Key*>(Storage);
+}
+
+template<class Key, size_t Capacity>
+const Key* InnerNode<Key, Capacity>::GetKeys() const
+{
+	return reinterpret_cast<const Key*>(Storage);
+}
+
+template<class T>
+void Relocate(T* Destination, T* Source, size_t Count)
+{
+	if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+	{
+		Memory::Memmove(Destination, Source, sizeof(T) * Count);
+	}
+	else if (Destination < Source)
+	{
+		for (size_t i = 0; i < Count; i++)
+		{
+			new (Destination + i) T(Move(Source[i]));
+			Source[i].~T();
+		}
+	}
+	else
+	{
+		for (size_t i = Count; i > 0; i--)
+		{
+			new (Destination + i - 1) T(Move(Source[i - 1]));
+			Source[i - 1].~T();
+		}
+	}
+}
+
+} // namespace OrderedDetails
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf>::OrderedIterator(Leaf* InLeaf, size_t InIndex)
+	: mLeaf(InLeaf)
+	, mIndex(InIndex)
+{
+}
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf>::OrderedIterator(const OrderedIterator<TypeTraits::RemoveConst<T>, Leaf>& Other)
+	: mLeaf(Other.mLeaf)
+	, mIndex(Other.mIndex)
+{
+}
+
+template<class T, class Leaf>
+typename OrderedIterator<T, Leaf>::ValueType& OrderedIterator<T, Leaf>::operator*() const
+{
+	return mLeaf->GetElements()[mIndex];
+}
+
+template<class T, class Leaf>
+typename OrderedIterator<T, Leaf>::ValueType* OrderedIterator<T, Leaf>::operator->() const
+{
+	return mLeaf->GetElements() + mIndex;
+}
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf>& OrderedIterator<T, Leaf>::operator++()
+{
+	if (++mIndex == mLeaf->Count && mLeaf->Next != nullptr)
+	{
+		mLeaf = mLeaf->Next;
+		mIndex = 0;
+	}
+	return *this;
+}
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf> OrderedIterator<T, Leaf>::operator++(int)
+{
+	OrderedIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf>& OrderedIterator<T, Leaf>::operator--()
+{
+	if (mIndex == 0 && mLeaf->Previous != nullptr)
+	{
+		mLeaf = mLeaf->Previous;
+		mIndex = mLeaf->Count - 1;
+	}
+	else
+	{
+		mIndex--;
+	}
+	return *this;
+}
+
+template<class T, class Leaf>
+OrderedIterator<T, Leaf> OrderedIterator<T, Leaf>::operator--(int)
+{
+	OrderedIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(const Allocator& InAllocator)
+	: Allocator(InAllocator)
+	, mRoot(nullptr)
+	, mFirst(nullptr)
+	, mLast(nullptr)
+	, mSize(0)
+{
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(std::initializer_list<ElementType> List, const Allocator& InAllocator)
+	: OrderedBase(InAllocator)
+{
+	Insert(List);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<ForwardIterable<T> Container>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(const Container& InContainer, const Allocator& InAllocator)
+	: OrderedBase(InAllocator)
+{
+	Insert(ContainerUtils::GetBegin(InContainer), ContainerUtils::GetEnd(InContainer));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<ForwardIterator<T> InIterator>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(InIterator Begin, InIterator End, const Allocator& InAllocator)
+	: OrderedBase(InAllocator)
+{
+	Insert(Begin, End);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(const OrderedBase& Other)
+	: OrderedBase(Other.GetAllocator())
+{
+	if (Other.mRoot != nullptr)
+	{
+		mRoot = CopyNode(Other.mRoot, nullptr);
+		mSize = Other.mSize;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class AnotherAllocator>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(const OrderedBase<KeyType, ElementType, ElementLessThanType, AnotherAllocator, IsUniqueKeys>& Other, const Allocator& InAllocator)
+	: OrderedBase(InAllocator)
+{
+	if (Other.mRoot != nullptr)
+	{
+		mRoot = CopyNode(Other.mRoot, nullptr);
+		mSize = Other.mSize;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::OrderedBase(OrderedBase&& Other)
+	: Allocator(static_cast<Allocator&&>(Other))
+	, mRoot(Other.mRoot)
+	, mFirst(Other.mFirst)
+	, mLast(Other.mLast)
+	, mSize(Other.mSize)
+{
+	Other.mRoot = nullptr;
+	Other.mFirst = nullptr;
+	Other.mLast = nullptr;
+	Other.mSize = 0;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::~OrderedBase()
+{
+	Clear();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>& OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::operator=(std::initializer_list<ElementType> List)
+{
+	Clear();
+	Insert(List);
+	return *this;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>& OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::operator=(const OrderedBase& Other)
+{
+	if (this != &Other)
+	{
+		Clear();
+
+		if (Other.mRoot != nullptr)
+		{
+			mRoot = CopyNode(Other.mRoot, nullptr);
+			mSize = Other.mSize;
+		}
+	}
+	return *this;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>& OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::operator=(OrderedBase&& Other)
+{
+	if (this != &Other)
+	{
+		Clear();
+
+		static_cast<Allocator&>(*this) = static_cast<Allocator&&>(Other);
+		mRoot = Other.mRoot;
+		mFirst = Other.mFirst;
+		mLast = Other.mLast;
+		mSize = Other.mSize;
+
+		Other.mRoot = nullptr;
+		Other.mFirst = nullptr;
+		Other.mLast = nullptr;
+		Other.mSize = 0;
+	}
+	return *this;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Clear()
+{
+	if (mRoot != nullptr)
+	{
+		DestroyNode(mRoot);
+
+		mRoot = nullptr;
+		mFirst = nullptr;
+		mLast = nullptr;
+		mSize = 0;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, bool> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Insert(const ElementType& InElement)
+{
+	if constexpr (!IsUniqueKeys)
+	{
+		// The given element may be stored in this container and get moved by the insertion.
+		ElementType Copy(InElement);
+		return InsertElement(Move(Copy));
+	}
+	else
+	{
+		return InsertElement(InElement);
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, bool> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Insert(ElementType&& InElement)
+{
+	return InsertElement(Move(InElement));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Insert(std::initializer_list<ElementType> List)
+{
+	Insert(List.begin(), List.end());
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<ForwardIterable<T> InContainer>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Insert(InContainer&& Container)
+{
+	Insert(ContainerUtils::GetBegin(Container), ContainerUtils::GetEnd(Container));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<ForwardIterator<T> InIterator>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Insert(InIterator Begin, InIterator End)
+{
+	for (; Begin != End; ++Begin)
+	{
+		Insert(*Begin);
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class... InArgs>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, bool> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Emplace(InArgs&&... Args)
+{
+	// The key is not known until the element is constructed.
+	ElementType NewElement(Forward<InArgs>(Args)...);
+	return InsertElement(Move(NewElement));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Erase(ConstIterator Position)
+{
+	KW_ASSERT(Position.mLeaf != nullptr && Position.mIndex < Position.mLeaf->Count, "Invalid iterator.");
+
+	return EraseAt(Position.mLeaf, Position.mIndex);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Erase(const KeyType& InKey)
+{
+	return EraseElements(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Count(const KeyType& InKey) const
+{
+	return CountElements(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Find(const KeyType& InKey)
+{
+	return FindElement(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Find(const KeyType& InKey) const
+{
+	return FindElement(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindRange(const KeyType& InKey)
+{
+	return FindElementRange(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator, typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindRange(const KeyType& InKey) const
+{
+	Pair<Iterator, Iterator> Result = FindElementRange(InKey);
+	return { Result.Key, Result.Value };
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::LowerBound(const KeyType& InKey)
+{
+	return FindLowerBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::LowerBound(const KeyType& InKey) const
+{
+	return FindLowerBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::UpperBound(const KeyType& InKey)
+{
+	return FindUpperBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::UpperBound(const KeyType& InKey) const
+{
+	return FindUpperBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+bool OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Contains(const KeyType& InKey) const
+{
+	return FindElement(InKey) != GetEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Erase(const K& InKey)
+{
+	return EraseElements(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Count(const K& InKey) const
+{
+	return CountElements(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Find(const K& InKey)
+{
+	return FindElement(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Find(const K& InKey) const
+{
+	return FindElement(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindRange(const K& InKey)
+{
+	return FindElementRange(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator, typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindRange(const K& InKey) const
+{
+	Pair<Iterator, Iterator> Result = FindElementRange(InKey);
+	return { Result.Key, Result.Value };
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::LowerBound(const K& InKey)
+{
+	return FindLowerBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::LowerBound(const K& InKey) const
+{
+	return FindLowerBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::UpperBound(const K& InKey)
+{
+	return FindUpperBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::UpperBound(const K& InKey) const
+{
+	return FindUpperBound(InKey);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<OrderedLookupKey<Key, ElementLessThan> K>
+bool OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Contains(const K& InKey) const
+{
+	return FindElement(InKey) != GetEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetBegin()
+{
+	return Iterator(mFirst, 0);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetBegin() const
+{
+	return ConstIterator(mFirst, 0);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetConstBegin() const
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetEnd()
+{
+	return Iterator(mLast, mLast != nullptr ? mLast->Count : 0);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetEnd() const
+{
+	return ConstIterator(mLast, mLast != nullptr ? mLast->Count : 0);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetConstEnd() const
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetReverseBegin()
+{
+	return ReverseIterator(mLast != nullptr ? Iterator(mLast, mLast->Count - 1) : Iterator(nullptr, 0));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetReverseBegin() const
+{
+	return ConstReverseIterator(mLast != nullptr ? ConstIterator(mLast, mLast->Count - 1) : ConstIterator(nullptr, 0));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetConstReverseBegin() const
+{
+	return GetReverseBegin();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetReverseEnd()
+{
+	// Decrementing the first element's iterator wraps its index around.
+	return ReverseIterator(mFirst != nullptr ? Iterator(mFirst, static_cast<size_t>(-1)) : Iterator(nullptr, 0));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetReverseEnd() const
+{
+	return ConstReverseIterator(mFirst != nullptr ? ConstIterator(mFirst, static_cast<size_t>(-1)) : ConstIterator(nullptr, 0));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstReverseIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetConstReverseEnd() const
+{
+	return GetReverseEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::begin()
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::begin() const
+{
+	return GetBegin();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::end()
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::ConstIterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::end() const
+{
+	return GetEnd();
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+bool OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::IsEmpty() const
+{
+	return mSize == 0;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetSize() const
+{
+	return mSize;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+const Allocator& OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class U>
+const Key& OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::GetKey(const U& Value)
+{
+	if constexpr (TypeTraits::IsSame<TypeTraits::RemoveConst<U>, KeyType>)
+	{
+		return Value;
+	}
+	else
+	{
+		return Value.Key;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class U, class K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindLowerBoundIndex(const U* Values, size_t ValueCount, const K& InKey)
+{
+	size_t Low = 0;
+	size_t High = ValueCount;
+	while (Low < High)
+	{
+		size_t Middle = (Low + High) / 2;
+		if (ElementLessThan()(GetKey(Values[Middle]), InKey))
+		{
+			Low = Middle + 1;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+	return Low;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class U, class K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindUpperBoundIndex(const U* Values, size_t ValueCount, const K& InKey)
+{
+	size_t Low = 0;
+	size_t High = ValueCount;
+	while (Low < High)
+	{
+		size_t Middle = (Low + High) / 2;
+		if (ElementLessThan()(InKey, GetKey(Values[Middle])))
+		{
+			High = Middle;
+		}
+		else
+		{
+			Low = Middle + 1;
+		}
+	}
+	return Low;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindLowerBound(const K& InKey) const
+{
+	if (mRoot == nullptr)
+	{
+		return Iterator(nullptr, 0);
+	}
+
+	// Keys before a child are less than the keys in its subtree, and keys after it are not less.
+	NodeType* Node = mRoot;
+	while (!Node->IsLeaf)
+	{
+		InnerType* Inner = static_cast<InnerType*>(Node);
+		Node = Inner->Children[FindLowerBoundIndex(Inner->GetKeys(), Inner->Count, InKey)];
+	}
+
+	LeafType* Leaf = static_cast<LeafType*>(Node);
+	return Normalize(Leaf, FindLowerBoundIndex(Leaf->GetElements(), Leaf->Count, InKey));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindUpperBound(const K& InKey) const
+{
+	if (mRoot == nullptr)
+	{
+		return Iterator(nullptr, 0);
+	}
+
+	NodeType* Node = mRoot;
+	while (!Node->IsLeaf)
+	{
+		InnerType* Inner = static_cast<InnerType*>(Node);
+		Node = Inner->Children[FindUpperBoundIndex(Inner->GetKeys(), Inner->Count, InKey)];
+	}
+
+	LeafType* Leaf = static_cast<LeafType*>(Node);
+	return Normalize(Leaf, FindUpperBoundIndex(Leaf->GetElements(), Leaf->Count, InKey));
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindElement(const K& InKey) const
+{
+	Iterator Result = FindLowerBound(InKey);
+	if (Result.mLeaf == nullptr || Result.mIndex == Result.mLeaf->Count || ElementLessThan()(InKey, GetKey(*Result)))
+	{
+		return Iterator(mLast, mLast != nullptr ? mLast->Count : 0);
+	}
+	return Result;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::CountElements(const K& InKey) const
+{
+	Pair<Iterator, Iterator> Range = FindElementRange(InKey);
+
+	size_t Result = 0;
+	for (Iterator It = Range.Key; It != Range.Value; ++It)
+	{
+		Result++;
+	}
+	return Result;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindElementRange(const K& InKey) const
+{
+	Iterator Begin = FindElement(InKey);
+	Iterator End = Iterator(mLast, mLast != nullptr ? mLast->Count : 0);
+	if (Begin == End)
+	{
+		return { End, End };
+	}
+
+	if constexpr (IsUniqueKeys)
+	{
+		Iterator Next = Begin;
+		return { Begin, ++Next };
+	}
+	else
+	{
+		return { Begin, FindUpperBound(InKey) };
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class K>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::EraseElements(const K& InKey)
+{
+	size_t Result = CountElements(InKey);
+
+	// Erasure moves elements between leaves, so the iterator returned by each erasure is used for the next one.
+	Iterator It = FindElement(InKey);
+	for (size_t i = 0; i < Result; i++)
+	{
+		It = EraseAt(It.mLeaf, It.mIndex);
+	}
+	return Result;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+template<class U>
+Pair<typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator, bool> OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::InsertElement(U&& InElement)
+{
+	const KeyType& ElementKey = GetKey(InElement);
+
+	if (mRoot == nullptr)
+	{
+		LeafType* Leaf = AllocateLeaf();
+		mRoot = Leaf;
+		mFirst = Leaf;
+		mLast = Leaf;
+	}
+
+	// Equal keys are inserted after the existing ones, so they keep the order of insertion.
+	NodeType* Node = mRoot;
+	while (!Node->IsLeaf)
+	{
+		InnerType* Inner = static_cast<InnerType*>(Node);
+		size_t ChildIndex = IsUniqueKeys ? FindLowerBoundIndex(Inner->GetKeys(), Inner->Count, ElementKey) : FindUpperBoundIndex(Inner->GetKeys(), Inner->Count, ElementKey);
+		Node = Inner->Children[ChildIndex];
+	}
+
+	LeafType* Leaf = static_cast<LeafType*>(Node);
+	size_t Index = IsUniqueKeys ? FindLowerBoundIndex(Leaf->GetElements(), Leaf->Count, ElementKey) : FindUpperBoundIndex(Leaf->GetElements(), Leaf->Count, ElementKey);
+
+	if constexpr (IsUniqueKeys)
+	{
+		// The lower bound is not less than the key, so it's equal unless the key is less than it. It may be the first
+		// element of the next leaf.
+		Iterator Existing = Normalize(Leaf, Index);
+		if (Existing.mIndex < Existing.mLeaf->Count && !ElementLessThan()(ElementKey, GetKey(*Existing)))
+		{
+			return { Existing, false };
+		}
+	}
+
+	if (Leaf->Count == LeafCapacity)
+	{
+		SplitLeaf(Leaf, Index, ElementKey);
+	}
+
+	ElementType* Elements = Leaf->GetElements();
+	OrderedDetails::Relocate(Elements + Index + 1, Elements + Index, Leaf->Count - Index);
+	new (Elements + Index) ElementType(Forward<U>(InElement));
+
+	Leaf->Count++;
+	mSize++;
+
+	return { Iterator(Leaf, Index), true };
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::SplitLeaf(LeafType*& Leaf, size_t& Index, const KeyType& InKey)
+{
+	LeafType* Right = AllocateLeaf();
+
+	// Appending to the last leaf starts a new one instead of splitting it in half, so inserting elements in order
+	// leaves full leaves behind, which is how large trees are usually built.
+	size_t SplitIndex = Index == Leaf->Count && Leaf->Next == nullptr ? Leaf->Count : Leaf->Count / 2;
+
+	OrderedDetails::Relocate(Right->GetElements(), Leaf->GetElements() + SplitIndex, Leaf->Count - SplitIndex);
+	Right->Count = static_cast<uint32_t>(Leaf->Count - SplitIndex);
+	Leaf->Count = static_cast<uint32_t>(SplitIndex);
+
+	Right->Previous = Leaf;
+	Right->Next = Leaf->Next;
+	if (Right->Next != nullptr)
+	{
+		Right->Next->Previous = Right;
+	}
+	else
+	{
+		mLast = Right;
+	}
+	Leaf->Next = Right;
+
+	// The separator may be any key between the last key of the left leaf and the first key of the right one. The new
+	// key is used when the right leaf is empty.
+	InsertIntoParent(Leaf, KeyType(Right->Count != 0 ? GetKey(Right->GetElements()[0]) : InKey), Right);
+
+	// An element at the split index may go to either leaf as far as the order is concerned, but the separator is only
+	// guaranteed to be not less than it, so it goes to the left leaf.
+	if (Index > SplitIndex || Right->Count == 0)
+	{
+		Leaf = Right;
+		Index -= SplitIndex;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::InsertIntoParent(NodeType* Left, KeyType&& Separator, NodeType* Right)
+{
+	InnerType* Parent = static_cast<InnerType*>(Left->Parent);
+	if (Parent == nullptr)
+	{
+		InnerType* NewRoot = AllocateInner();
+		new (NewRoot->GetKeys()) KeyType(Move(Separator));
+		NewRoot->Children[0] = Left;
+		NewRoot->Children[1] = Right;
+		NewRoot->Count = 1;
+
+		Left->Parent = NewRoot;
+		Right->Parent = NewRoot;
+		mRoot = NewRoot;
+		return;
+	}
+
+	size_t Index = FindChildIndex(Parent, Left);
+	if (Parent->Count < InnerCapacity)
+	{
+		InsertIntoInner(Parent, Index, Move(Separator), Right);
+		return;
+	}
+
+	// The middle key moves up to the grandparent, the keys and children after it move to a new node.
+	InnerType* NewInner = AllocateInner();
+	size_t Middle = Parent->Count / 2;
+	KeyType* Keys = Parent->GetKeys();
+
+	OrderedDetails::Relocate(NewInner->GetKeys(), Keys + Middle + 1, Parent->Count - Middle - 1);
+	for (size_t i = Middle + 1; i <= Parent->Count; i++)
+	{
+		NewInner->Children[i - Middle - 1] = Parent->Children[i];
+		Parent->Children[i]->Parent = NewInner;
+	}
+
+	NewInner->Count = static_cast<uint32_t>(Parent->Count - Middle - 1);
+	Parent->Count = static_cast<uint32_t>(Middle);
+
+	KeyType MiddleKey(Move(Keys[Middle]));
+	Keys[Middle].~KeyType();
+
+	if (Index <= Middle)
+	{
+		InsertIntoInner(Parent, Index, Move(Separator), Right);
+	}
+	else
+	{
+		InsertIntoInner(NewInner, Index - Middle - 1, Move(Separator), Right);
+	}
+
+	InsertIntoParent(Parent, Move(MiddleKey), NewInner);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::InsertIntoInner(InnerType* Node, size_t Index, KeyType&& Separator, NodeType* Child)
+{
+	KeyType* Keys = Node->GetKeys();
+	OrderedDetails::Relocate(Keys + Index + 1, Keys + Index, Node->Count - Index);
+	new (Keys + Index) KeyType(Move(Separator));
+
+	for (size_t i = Node->Count + 1; i > Index + 1; i--)
+	{
+		Node->Children[i] = Node->Children[i - 1];
+	}
+	Node->Children[Index + 1] = Child;
+	Child->Parent = Node;
+
+	Node->Count++;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::RemoveFromInner(InnerType* Node, size_t Index)
+{
+	KeyType* Keys = Node->GetKeys();
+	Keys[Index].~KeyType();
+	OrderedDetails::Relocate(Keys + Index, Keys + Index + 1, Node->Count - Index - 1);
+
+	for (size_t i = Index + 1; i < Node->Count; i++)
+	{
+		Node->Children[i] = Node->Children[i + 1];
+	}
+
+	Node->Count--;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::EraseAt(LeafType* Leaf, size_t Index)
+{
+	ElementType* Elements = Leaf->GetElements();
+	Elements[Index].~ElementType();
+	OrderedDetails::Relocate(Elements + Index, Elements + Index + 1, Leaf->Count - Index - 1);
+
+	Leaf->Count--;
+	mSize--;
+
+	if (Leaf == mRoot)
+	{
+		if (Leaf->Count == 0)
+		{
+			LeafAllocator(GetAllocator()).Deallocate(Leaf);
+
+			mRoot = nullptr;
+			mFirst = nullptr;
+			mLast = nullptr;
+			return Iterator(nullptr, 0);
+		}
+		return Normalize(Leaf, Index);
+	}
+
+	if (Leaf->Count >= MinLeafCount)
+	{
+		return Normalize(Leaf, Index);
+	}
+
+	InnerType* Parent = static_cast<InnerType*>(Leaf->Parent);
+	size_t ChildIndex = FindChildIndex(Parent, Leaf);
+	LeafType* Left = ChildIndex > 0 ? static_cast<LeafType*>(Parent->Children[ChildIndex - 1]) : nullptr;
+	LeafType* Right = ChildIndex < Parent->Count ? static_cast<LeafType*>(Parent->Children[ChildIndex + 1]) : nullptr;
+
+	// The first key of the right node of a pair is a valid separator for them.
+	if (Left != nullptr && Left->Count > MinLeafCount)
+	{
+		OrderedDetails::Relocate(Elements + 1, Elements, Leaf->Count);
+		OrderedDetails::Relocate(Elements, Left->GetElements() + Left->Count - 1, 1);
+		Left->Count--;
+		Leaf->Count++;
+
+		Parent->GetKeys()[ChildIndex - 1] = GetKey(Elements[0]);
+		return Normalize(Leaf, Index + 1);
+	}
+
+	if (Right != nullptr && Right->Count > MinLeafCount)
+	{
+		ElementType* RightElements = Right->GetElements();
+		OrderedDetails::Relocate(Elements + Leaf->Count, RightElements, 1);
+		OrderedDetails::Relocate(RightElements, RightElements + 1, Right->Count - 1);
+		Right->Count--;
+		Leaf->Count++;
+
+		Parent->GetKeys()[ChildIndex] = GetKey(RightElements[0]);
+		return Normalize(Leaf, Index);
+	}
+
+	// Merge the right leaf of a pair into the left one.
+	LeafType* MergeLeft = Left != nullptr ? Left : Leaf;
+	LeafType* MergeRight = Left != nullptr ? Leaf : Right;
+	size_t Offset = Left != nullptr ? Left->Count : 0;
+
+	OrderedDetails::Relocate(MergeLeft->GetElements() + MergeLeft->Count, MergeRight->GetElements(), MergeRight->Count);
+	MergeLeft->Count += MergeRight->Count;
+
+	MergeLeft->Next = MergeRight->Next;
+	if (MergeLeft->Next != nullptr)
+	{
+		MergeLeft->Next->Previous = MergeLeft;
+	}
+	else
+	{
+		mLast = MergeLeft;
+	}
+
+	RemoveFromInner(Parent, Left != nullptr ? ChildIndex - 1 : ChildIndex);
+	LeafAllocator(GetAllocator()).Deallocate(MergeRight);
+
+	// Rebalancing inner nodes doesn't move elements.
+	RebalanceInner(Parent);
+	return Normalize(MergeLeft, Offset + Index);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::RebalanceInner(InnerType* Node)
+{
+	while (true)
+	{
+		if (Node == mRoot)
+		{
+			// A root with a single child gives its place to the child.
+			if (Node->Count == 0)
+			{
+				mRoot = Node->Children[0];
+				mRoot->Parent = nullptr;
+				InnerAllocator(GetAllocator()).Deallocate(Node);
+			}
+			return;
+		}
+
+		if (Node->Count >= MinInnerCount)
+		{
+			return;
+		}
+
+		InnerType* Parent = static_cast<InnerType*>(Node->Parent);
+		size_t ChildIndex = FindChildIndex(Parent, Node);
+		InnerType* Left = ChildIndex > 0 ? static_cast<InnerType*>(Parent->Children[ChildIndex - 1]) : nullptr;
+		InnerType* Right = ChildIndex < Parent->Count ? static_cast<InnerType*>(Parent->Children[ChildIndex + 1]) : nullptr;
+
+		KeyType* Keys = Node->GetKeys();
+		KeyType* ParentKeys = Parent->GetKeys();
+
+		// Rotate the last child of the left neighbour through the parent.
+		if (Left != nullptr && Left->Count > MinInnerCount)
+		{
+			KeyType* LeftKeys = Left->GetKeys();
+
+			OrderedDetails::Relocate(Keys + 1, Keys, Node->Count);
+			new (Keys) KeyType(Move(ParentKeys[ChildIndex - 1]));
+			ParentKeys[ChildIndex - 1] = Move(LeftKeys[Left->Count - 1]);
+			LeftKeys[Left->Count - 1].~KeyType();
+
+			for (size_t i = Node->Count + 1; i > 0; i--)
+			{
+				Node->Children[i] = Node->Children[i - 1];
+			}
+			Node->Children[0] = Left->Children[Left->Count];
+			Node->Children[0]->Parent = Node;
+
+			Left->Count--;
+			Node->Count++;
+			return;
+		}
+
+		// Rotate the first child of the right neighbour through the parent.
+		if (Right != nullptr && Right->Count > MinInnerCount)
+		{
+			KeyType* RightKeys = Right->GetKeys();
+
+			new (Keys + Node->Count) KeyType(Move(ParentKeys[ChildIndex]));
+			ParentKeys[ChildIndex] = Move(RightKeys[0]);
+			RightKeys[0].~KeyType();
+			OrderedDetails::Relocate(RightKeys, RightKeys + 1, Right->Count - 1);
+
+			Node->Children[Node->Count + 1] = Right->Children[0];
+			Node->Children[Node->Count + 1]->Parent = Node;
+			for (size_t i = 0; i < Right->Count; i++)
+			{
+				Right->Children[i] = Right->Children[i + 1];
+			}
+
+			Right->Count--;
+			Node->Count++;
+			return;
+		}
+
+		// Merge the right node of a pair, and the parent's key between them, into the left one.
+		InnerType* MergeLeft = Left != nullptr ? Left : Node;
+		InnerType* MergeRight = Left != nullptr ? Node : Right;
+		size_t KeyIndex = Left != nullptr ? ChildIndex - 1 : ChildIndex;
+		KeyType* MergeKeys = MergeLeft->GetKeys();
+
+		new (MergeKeys + MergeLeft->Count) KeyType(Move(ParentKeys[KeyIndex]));
+		OrderedDetails::Relocate(MergeKeys + MergeLeft->Count + 1, MergeRight->GetKeys(), MergeRight->Count);
+		for (size_t i = 0; i <= MergeRight->Count; i++)
+		{
+			MergeLeft->Children[MergeLeft->Count + 1 + i] = MergeRight->Children[i];
+			MergeRight->Children[i]->Parent = MergeLeft;
+		}
+		MergeLeft->Count += MergeRight->Count + 1;
+
+		RemoveFromInner(Parent, KeyIndex);
+		InnerAllocator(GetAllocator()).Deallocate(MergeRight);
+
+		Node = Parent;
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+size_t OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::FindChildIndex(const InnerType* Parent, const NodeType* Child)
+{
+	size_t Index = 0;
+	while (Parent->Children[Index] != Child)
+	{
+		Index++;
+	}
+	return Index;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Iterator OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::Normalize(LeafType* Leaf, size_t Index)
+{
+	if (Index == Leaf->Count && Leaf->Next != nullptr)
+	{
+		return Iterator(Leaf->Next, 0);
+	}
+	return Iterator(Leaf, Index);
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::NodeType* OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::CopyNode(const NodeType* Source, InnerType* Parent)
+{
+	if (Source->IsLeaf)
+	{
+		const LeafType* SourceLeaf = static_cast<const LeafType*>(Source);
+		LeafType* Leaf = AllocateLeaf();
+
+		for (size_t i = 0; i < SourceLeaf->Count; i++)
+		{
+			new (Leaf->GetElements() + i) ElementType(SourceLeaf->GetElements()[i]);
+		}
+		Leaf->Count = SourceLeaf->Count;
+		Leaf->Parent = Parent;
+
+		Leaf->Previous = mLast;
+		if (mLast != nullptr)
+		{
+			mLast->Next = Leaf;
+		}
+		else
+		{
+			mFirst = Leaf;
+		}
+		mLast = Leaf;
+
+		return Leaf;
+	}
+
+	const InnerType* SourceInner = static_cast<const InnerType*>(Source);
+	InnerType* Inner = AllocateInner();
+
+	for (size_t i = 0; i < SourceInner->Count; i++)
+	{
+		new (Inner->GetKeys() + i) KeyType(SourceInner->GetKeys()[i]);
+	}
+	for (size_t i = 0; i <= SourceInner->Count; i++)
+	{
+		Inner->Children[i] = CopyNode(SourceInner->Children[i], Inner);
+	}
+	Inner->Count = SourceInner->Count;
+	Inner->Parent = Parent;
+
+	return Inner;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+void OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::DestroyNode(NodeType* Node)
+{
+	if (Node->IsLeaf)
+	{
+		LeafType* Leaf = static_cast<LeafType*>(Node);
+		for (size_t i = 0; i < Leaf->Count; i++)
+		{
+			Leaf->GetElements()[i].~ElementType();
+		}
+		LeafAllocator(GetAllocator()).Deallocate(Leaf);
+	}
+	else
+	{
+		InnerType* Inner = static_cast<InnerType*>(Node);
+		for (size_t i = 0; i < Inner->Count; i++)
+		{
+			Inner->GetKeys()[i].~KeyType();
+		}
+		for (size_t i = 0; i <= Inner->Count; i++)
+		{
+			DestroyNode(Inner->Children[i]);
+		}
+		InnerAllocator(GetAllocator()).Deallocate(Inner);
+	}
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::LeafType* OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::AllocateLeaf()
+{
+	LeafType* Leaf = LeafAllocator(GetAllocator()).Allocate(1);
+	Leaf->Parent = nullptr;
+	Leaf->Count = 0;
+	Leaf->IsLeaf = true;
+	Leaf->Previous = nullptr;
+	Leaf->Next = nullptr;
+	return Leaf;
+}
+
+template<class Key, class T, class ElementLessThan, class Allocator, bool IsUniqueKeys>
+typename OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::InnerType* OrderedBase<Key, T, ElementLessThan, Allocator, IsUniqueKeys>::AllocateInner()
+{
+	InnerType* Inner = InnerAllocator(GetAllocator()).Allocate(1);
+	Inner->Parent = nullptr;
+	Inner->Count = 0;
+	Inner->IsLeaf = false;
+	return Inner;
+}
+
 } // namespace kw
@@ -11,11 +11,18 @@ namespace kw
 // A sorted associative container that contains key-value pairs that supports equivalent keys. Keys are sorted by using
 // the specified comparison function. Search, removal, and insertion operations have logarithmic complexity.
 template<class Key, class Value, class KeyLessThan = LessThan<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>>
-class OrderedMultiMap : public OrderedBase<Key, Pair<const Key, Value>, PairKeyLessThan<const Key, Value, KeyLessThan>, Allocator, true>
+class OrderedMultiMap : public OrderedBase<Key, Pair<const Key, Value>, PairKeyLessThan<const Key, Value, KeyLessThan>, Allocator, false>
 {
+	using BaseType = OrderedBase<Key, Pair<const Key, Value>, PairKeyLessThan<const Key, Value, KeyLessThan>, Allocator, false>;
+
 public:
+	using typename BaseType::KeyType;
+	using typename BaseType::ElementType;
 	using ValueType = Value;
 	using KeyLessThanType = KeyLessThan;
+
+	using BaseType::BaseType;
+	using BaseType::operator=;
 };
 
 } // namespace kw
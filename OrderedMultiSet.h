@@ -10,10 +10,17 @@ namespace kw
 // A sorted associative container that contains set of possibly non-unique objects of the given type. Keys are sorted
 // by using the specified comparison function. Search, removal, and insertion operations have logarithmic complexity.
 template<class Key, class KeyLessThan = LessThan<Key>, class Allocator = MallocAllocator<Key>>
-class OrderedMultiSet : public OrderedBase<Key, Key, KeyLessThan, Allocator, true>
+class OrderedMultiSet : public OrderedBase<Key, Key, KeyLessThan, Allocator, false>
 {
+	using BaseType = OrderedBase<Key, Key, KeyLessThan, Allocator, false>;
+
 public:
+	using typename BaseType::KeyType;
+	using typename BaseType::ElementType;
 	using KeyLessThanType = KeyLessThan;
+
+	using BaseType::BaseType;
+	using BaseType::operator=;
 };
 
 } // namespace kw
@@ -10,10 +10,17 @@ namespace kw
 // A sorted associative container that contains set of unique objects of the given type. Keys are sorted by using
 // the specified comparison function. Search, removal, and insertion operations have logarithmic complexity.
 template<class Key, class KeyLessThan = LessThan<Key>, class Allocator = MallocAllocator<Key>>
-class OrderedSet : public OrderedBase<Key, Key, KeyLessThan, Allocator, false>
+class OrderedSet : public OrderedBase<Key, Key, KeyLessThan, Allocator, true>
 {
+	using BaseType = OrderedBase<Key, Key, KeyLessThan, Allocator, true>;
+
 public:
+	using typename BaseType::KeyType;
+	using typename BaseType::ElementType;
 	using KeyLessThanType = KeyLessThan;
+
+	using BaseType::BaseType;
+	using BaseType::operator=;
 };
 
 } // namespace kw
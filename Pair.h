@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Concepts.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
 namespace kw
 {
 
@@ -27,30 +31,166 @@ struct Pair
 			return Lhs.Key <=> Rhs.Key;
 		}
 	}
+
+	// Return whether both members of the pairs are equal. Pairs with equal keys and values are equal keys of hash
+	// containers.
+	template<class OtherKeyType, class OtherValueType>
+		requires EqualityComparableWith<KeyType, OtherKeyType> && EqualityComparableWith<ValueType, OtherValueType>
+	friend bool operator==(const Pair<KeyType, ValueType>& Lhs, const Pair<OtherKeyType, OtherValueType>& Rhs)
+	{
+		return Lhs.Key == Rhs.Key && Lhs.Value == Rhs.Value;
+	}
+};
+
+// Hash of pairs combines the hashes of both members, so pairs can be keys of hash containers.
+template<class T, class U>
+struct Hash<Pair<T, U>>
+{
+	size_t operator()(const Pair<T, U>& Value) const;
+};
+
+namespace PairDetails
+{
+
+// Declares `IsTransparent` if the given functor does, so pair functors are as transparent as the key functors.
+template<class F>
+struct TransparentBase
+{
 };
 
+template<Transparent F>
+struct TransparentBase<F>
+{
+	using IsTransparent = void;
+};
+
+} // namespace PairDetails
+
 // Hasher that takes a pair as a parameter but returns hash of a key only. Useful for associative containers.
 template<class T, class U, class KeyHash>
-struct PairKeyHash
+struct PairKeyHash : PairDetails::TransparentBase<KeyHash>
 {
 	// Return hash of Value.Key using the specified hasher.
 	size_t operator()(const Pair<T, U>& Value) const;
+
+	// Return hash of the given key using the specified hasher.
+	size_t operator()(const T& Key) const;
+
+	// Return hash of the given key of another type. Only available for transparent hashers.
+	template<class K>
+		requires Transparent<KeyHash> && Invocable<const KeyHash&, const K&>
+	size_t operator()(const K& Key) const;
 };
 
 // Comparator that takes a pair as a parameter but compares keys only. Useful for associative containers.
 template<class T, class U, class KeyEqualTo>
-struct PairKeyEqualTo
+struct PairKeyEqualTo : PairDetails::TransparentBase<KeyEqualTo>
 {
 	// Return whether Lhs.Key is equal to Rhs.Key using the specified comparator.
 	bool operator()(const Pair<T, U>& Lhs, const Pair<T, U>& Rhs) const;
+
+	// Return whether the given keys are equal using the specified comparator.
+	bool operator()(const T& Lhs, const T& Rhs) const;
+
+	// Return whether the given key is equal to the key of another type. Only available for transparent comparators.
+	template<class K>
+		requires Transparent<KeyEqualTo> && Invocable<const KeyEqualTo&, const T&, const K&>
+	bool operator()(const T& Lhs, const K& Rhs) const;
 };
 
 // Comparator that takes a pair as a parameter but compares keys only. Useful for associative containers.
 template<class T, class U, class KeyLessThan>
-struct PairKeyLessThan
+struct PairKeyLessThan : PairDetails::TransparentBase<KeyLessThan>
 {
 	// Return whether Lhs.Key is less than Rhs.Key using the specified comparator.
 	bool operator()(const Pair<T, U>& Lhs, const Pair<T, U>& Rhs) const;
+
+	// Return whether the given key Lhs is less than Rhs using the specified comparator.
+	bool operator()(const T& Lhs, const T& Rhs) const;
+
+	// Compare the given key with the key of another type. Only available for transparent comparators.
+	template<class K>
+		requires Transparent<KeyLessThan> && Invocable<const KeyLessThan&, const T&, const K&>
+	bool operator()(const T& Lhs, const K& Rhs) const;
+	template<class K>
+		requires Transparent<KeyLessThan> && Invocable<const KeyLessThan&, const K&, const T&>
+	bool operator()(const K& Lhs, const T& Rhs) const;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T, class U>
+size_t Hash<Pair<T, U>>::operator()(const Pair<T, U>& Value) const
+{
+	return HashCombine(Hash<TypeTraits::RemoveConst<T>>()(Value.Key), Hash<TypeTraits::RemoveConst<U>>()(Value.Value));
+}
+
+template<class T, class U, class KeyHash>
+size_t PairKeyHash<T, U, KeyHash>::operator()(const Pair<T, U>& Value) const
+{
+	return KeyHash()(Value.Key);
+}
+
+template<class T, class U, class KeyHash>
+size_t PairKeyHash<T, U, KeyHash>::operator()(const T& Key) const
+{
+	return KeyHash()(Key);
+}
+
+template<class T, class U, class KeyHash>
+template<class K>
+	requires Transparent<KeyHash> && Invocable<const KeyHash&, const K&>
+size_t PairKeyHash<T, U, KeyHash>::operator()(const K& Key) const
+{
+	return KeyHash()(Key);
+}
+
+template<class T, class U, class KeyEqualTo>
+bool PairKeyEqualTo<T, U, KeyEqualTo>::operator()(const Pair<T, U>& Lhs, const Pair<T, U>& Rhs) const
+{
+	return KeyEqualTo()(Lhs.Key, Rhs.Key);
+}
+
+template<class T, class U, class KeyEqualTo>
+bool PairKeyEqualTo<T, U, KeyEqualTo>::operator()(const T& Lhs, const T& Rhs) const
+{
+	return KeyEqualTo()(Lhs, Rhs);
+}
+
+template<class T, class U, class KeyEqualTo>
+template<class K>
+	requires Transparent<KeyEqualTo> && Invocable<const KeyEqualTo&, const T&, const K&>
+bool PairKeyEqualTo<T, U, KeyEqualTo>::operator()(const T& Lhs, const K& Rhs) const
+{
+	return KeyEqualTo()(Lhs, Rhs);
+}
+
+template<class T, class U, class KeyLessThan>
+bool PairKeyLessThan<T, U, KeyLessThan>::operator()(const Pair<T, U>& Lhs, const Pair<T, U>& Rhs) const
+{
+	return KeyLessThan()(Lhs.Key, Rhs.Key);
+}
+
+template<class T, class U, class KeyLessThan>
+bool PairKeyLessThan<T, U, KeyLessThan>::operator()(const T& Lhs, const T& Rhs) const
+{
+	return KeyLessThan()(Lhs, Rhs);
+}
+
+template<class T, class U, class KeyLessThan>
+template<class K>
+	requires Transparent<KeyLessThan> && Invocable<const KeyLessThan&, const T&, const K&>
+bool PairKeyLessThan<T, U, KeyLessThan>::operator()(const T& Lhs, const K& Rhs) const
+{
+	return KeyLessThan()(Lhs, Rhs);
+}
+
+template<class T, class U, class KeyLessThan>
+template<class K>
+	requires Transparent<KeyLessThan> && Invocable<const KeyLessThan&, const K&, const T&>
+bool PairKeyLessThan<T, U, KeyLessThan>::operator()(const K& Lhs, const T& Rhs) const
+{
+	return KeyLessThan()(Lhs, Rhs);
+}
+
 } // namespace kw
@@ -0,0 +1,964 @@
+#pragma once
+
+#include "HashTraits.h"
+#include "Macros.h"
+#include "Memory.h"
+#include "Pair.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <bit>
+#include <cstdint>
+#include <new>
+
+namespace kw
+{
+
+template<class Traits>
+class RobinHoodHashTable;
+
+// Bidirectional iterator over elements of `RobinHoodHashTable`. Empty slots are skipped, so an increment is amortized
+// constant.
+template<class T, class NodeType>
+class RobinHoodHashIterator
+{
+public:
+	using ValueType = T;
+
+	RobinHoodHashIterator() = default;
+	explicit RobinHoodHashIterator(NodeType* InNode);
+	RobinHoodHashIterator(const RobinHoodHashIterator<TypeTraits::RemoveConst<T>, TypeTraits::RemoveConst<NodeType>>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	RobinHoodHashIterator& operator++();
+	RobinHoodHashIterator operator++(int);
+
+	RobinHoodHashIterator& operator--();
+	RobinHoodHashIterator operator--(int);
+
+	friend auto operator<=>(const RobinHoodHashIterator& Lhs, const RobinHoodHashIterator& Rhs) = default;
+
+private:
+	template<class U, class V>
+	friend class RobinHoodHashIterator;
+
+	template<class Traits>
+	friend class RobinHoodHashTable;
+
+	NodeType* mNode;
+};
+
+// Open addressing table with Robin Hood hashing and linear probing. Every element stores its probe distance from its
+// home slot, and an insertion displaces elements that are closer to their home slots, so elements are always sorted
+// by home slot. Lookups stop as soon as they meet an element closer to its home than the searched key would be.
+// Erasure shifts the following displaced elements back by one slot instead of leaving a tombstone, so probe lengths
+// don't degrade under churn. Elements are stored inline with their distances, so a lookup that hits usually touches
+// a single cache line. See `HashBase` for the interface.
+template<class Traits>
+class RobinHoodHashTable : protected Traits::AllocatorType
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	struct Node
+	{
+		ElementType Element;
+		uint32_t Distance;
+	};
+
+	using Iterator = RobinHoodHashIterator<ElementType, Node>;
+	using ConstIterator = RobinHoodHashIterator<const ElementType, const Node>;
+
+	explicit RobinHoodHashTable(const AllocatorType& InAllocator);
+	RobinHoodHashTable(const RobinHoodHashTable& Other);
+	RobinHoodHashTable(RobinHoodHashTable&& Other);
+	~RobinHoodHashTable();
+
+	template<class OtherTraits>
+	RobinHoodHashTable(const RobinHoodHashTable<OtherTraits>& Other, const AllocatorType& InAllocator);
+
+	RobinHoodHashTable& operator=(const RobinHoodHashTable& Other);
+	RobinHoodHashTable& operator=(RobinHoodHashTable&& Other);
+
+	void Reserve(size_t Capacity);
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+
+	// Reallocate the table with the least number of home slots that fits the given number of elements and all the
+	// current ones. An empty table with zero capacity frees its memory.
+	void Rehash(size_t Capacity);
+
+	// Return the index of the first element with the given key or `GetEndIndex()` if it doesn't exist. The key is
+	// either `KeyType` or a `HashLookupKey`.
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+
+	// Return the index past the last element of the run of equal keys that starts at the given index.
+	size_t FindRunEnd(size_t Index) const;
+
+	// For unique keys, return the index of an existing element with the given key and false, if there's one.
+	// Otherwise make room for a new element and return its index and true. The caller constructs the element.
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+
+	// Return whether an insertion of a new element may rehash the table.
+	bool IsFull() const;
+
+	// Start loading the memory of the home slot of the given hash.
+	void Prefetch(size_t Hash) const;
+
+	// Destroy the element at the given index. Return the index of the element that follows it in the iteration order.
+	size_t EraseIndex(size_t Index);
+
+	// Destroy the run of equal keys of the given length that starts at the given index. Keys aren't compared, so the
+	// elements of the run may be moved from already.
+	void EraseRun(size_t Index, size_t Count);
+
+	// Return the index of the first element starting from the given index, or `GetEndIndex()`.
+	size_t SkipEmpty(size_t Index) const;
+
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	// Iterators to the first element, past the last element, to the last element, and before the first element.
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits>
+	friend class RobinHoodHashTable;
+
+	// Distance of an empty slot. Occupied slots store the probe distance from the home slot plus one.
+	static constexpr uint32_t Empty = 0;
+
+	// Distance of the sentinel nodes before the first and after the last slot. Iterators treat them as occupied and
+	// stop there. Lookups and backward shifts treat them as elements in their home slots and stop there too.
+	static constexpr uint32_t Sentinel = 1;
+
+	// The number of elements never exceeds the maximum load factor times the number of home slots. Backward shift
+	// deletion keeps probes short at high load, but the shifts grow long past the upper bound.
+	static constexpr float DefaultMaxLoadFactor = 0.8f;
+	static constexpr float MinMaxLoadFactor = 0.125f;
+	static constexpr float MaxMaxLoadFactor = 0.95f;
+
+	// Minimum number of home slots of a non-empty table.
+	static constexpr size_t MinCapacity = 8;
+
+	// Slots after the last home slot let the probe sequence run past the end without wrapping around. Without
+	// wrapping, backward shift deletion never moves an element over the iteration position.
+	static constexpr size_t MaxOverflow = 64;
+
+	using NodeAllocator = typename HashDetails::RebindAllocator<AllocatorType, Node>::Type;
+
+	// Return how many elements the given number of home slots can store.
+	size_t GetMaxSize(size_t Capacity) const;
+
+	// Return the least number of home slots that can store the given number of elements.
+	size_t GetMinCapacity(size_t Size) const;
+
+	// Return the home slot of the given hash.
+	size_t GetHomeIndex(size_t Hash) const;
+
+	// Make room for a new element with the given distance at the given index by shifting the following elements.
+	void PrepareInsert(size_t Index, uint32_t Distance);
+
+	// Move all elements to a table with the given number of home slots.
+	void RehashNodes(size_t Capacity);
+
+	// Reallocate the table with a larger overflow area. Elements keep their indices.
+	void ExtendOverflow();
+
+	// Copy the elements from the given table into this empty table.
+	template<class OtherTable>
+	void CopyNodes(const OtherTable& Other);
+
+	void DestroyElements();
+
+	Node* AllocateNodes(size_t NodeCount);
+	void DeallocateNodes(Node* Nodes);
+
+	Node* mNodes;
+	size_t mSize;
+
+	// Number of home slots. Either zero or a power of two.
+	size_t mCapacity;
+
+	// Number of home slots plus the overflow area.
+	size_t mNodeCount;
+
+	// Number of elements that fit into the home slots at the maximum load factor.
+	size_t mMaxSize;
+
+	float mMaxLoadFactor;
+};
+
+// Layout of hash containers that uses `RobinHoodHashTable`. Good all-round choice and the default one.
+struct RobinHoodHashLayout
+{
+	template<class Traits>
+	using Table = RobinHoodHashTable<Traits>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType>::RobinHoodHashIterator(NodeType* InNode)
+	: mNode(InNode)
+{
+}
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType>::RobinHoodHashIterator(const RobinHoodHashIterator<TypeTraits::RemoveConst<T>, TypeTraits::RemoveConst<NodeType>>& Other)
+	: mNode(Other.mNode)
+{
+}
+
+template<class T, class NodeType>
+typename RobinHoodHashIterator<T, NodeType>::ValueType& RobinHoodHashIterator<T, NodeType>::operator*() const
+{
+	return mNode->Element;
+}
+
+template<class T, class NodeType>
+typename RobinHoodHashIterator<T, NodeType>::ValueType* RobinHoodHashIterator<T, NodeType>::operator->() const
+{
+	return &mNode->Element;
+}
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType>& RobinHoodHashIterator<T, NodeType>::operator++()
+{
+	// Empty slots have zero distance. The sentinel after the last slot doesn't, so there's no need for bound checks.
+	do
+	{
+		++mNode;
+	}
+	while (mNode->Distance == 0);
+
+	return *this;
+}
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType> RobinHoodHashIterator<T, NodeType>::operator++(int)
+{
+	RobinHoodHashIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType>& RobinHoodHashIterator<T, NodeType>::operator--()
+{
+	do
+	{
+		--mNode;
+	}
+	while (mNode->Distance == 0);
+
+	return *this;
+}
+
+template<class T, class NodeType>
+RobinHoodHashIterator<T, NodeType> RobinHoodHashIterator<T, NodeType>::operator--(int)
+{
+	RobinHoodHashIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits>
+RobinHoodHashTable<Traits>::RobinHoodHashTable(const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mNodes(nullptr)
+	, mSize(0)
+	, mCapacity(0)
+	, mNodeCount(0)
+	, mMaxSize(0)
+	, mMaxLoadFactor(DefaultMaxLoadFactor)
+{
+}
+
+template<class Traits>
+RobinHoodHashTable<Traits>::RobinHoodHashTable(const RobinHoodHashTable& Other)
+	: RobinHoodHashTable(Other.GetAllocator())
+{
+	CopyNodes(Other);
+}
+
+template<class Traits>
+template<class OtherTraits>
+RobinHoodHashTable<Traits>::RobinHoodHashTable(const RobinHoodHashTable<OtherTraits>& Other, const AllocatorType& InAllocator)
+	: RobinHoodHashTable(InAllocator)
+{
+	CopyNodes(Other);
+}
+
+template<class Traits>
+RobinHoodHashTable<Traits>::RobinHoodHashTable(RobinHoodHashTable&& Other)
+	: AllocatorType(static_cast<AllocatorType&&>(Other))
+	, mNodes(Other.mNodes)
+	, mSize(Other.mSize)
+	, mCapacity(Other.mCapacity)
+	, mNodeCount(Other.mNodeCount)
+	, mMaxSize(Other.mMaxSize)
+	, mMaxLoadFactor(Other.mMaxLoadFactor)
+{
+	Other.mNodes = nullptr;
+	Other.mSize = 0;
+	Other.mCapacity = 0;
+	Other.mNodeCount = 0;
+	Other.mMaxSize = 0;
+}
+
+template<class Traits>
+RobinHoodHashTable<Traits>::~RobinHoodHashTable()
+{
+	DestroyElements();
+	DeallocateNodes(mNodes);
+}
+
+template<class Traits>
+RobinHoodHashTable<Traits>& RobinHoodHashTable<Traits>::operator=(const RobinHoodHashTable& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateNodes(mNodes);
+
+		mNodes = nullptr;
+		mSize = 0;
+		mCapacity = 0;
+		mNodeCount = 0;
+		mMaxSize = 0;
+
+		CopyNodes(Other);
+	}
+	return *this;
+}
+
+template<class Traits>
+RobinHoodHashTable<Traits>& RobinHoodHashTable<Traits>::operator=(RobinHoodHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateNodes(mNodes);
+
+		static_cast<AllocatorType&>(*this) = static_cast<AllocatorType&&>(Other);
+
+		mNodes = Other.mNodes;
+		mSize = Other.mSize;
+		mCapacity = Other.mCapacity;
+		mNodeCount = Other.mNodeCount;
+		mMaxSize = Other.mMaxSize;
+		mMaxLoadFactor = Other.mMaxLoadFactor;
+
+		Other.mNodes = nullptr;
+		Other.mSize = 0;
+		Other.mCapacity = 0;
+		Other.mNodeCount = 0;
+		Other.mMaxSize = 0;
+	}
+	return *this;
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::Reserve(size_t Capacity)
+{
+	size_t NewCapacity = GetMinCapacity(Capacity);
+	if (NewCapacity > mCapacity)
+	{
+		RehashNodes(NewCapacity);
+	}
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::Clear()
+{
+	DestroyElements();
+
+	for (size_t i = 0; i < mNodeCount; i++)
+	{
+		mNodes[i].Distance = Empty;
+	}
+
+	mSize = 0;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetSize() const
+{
+	return mSize;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetCapacity() const
+{
+	return mMaxSize;
+}
+
+template<class Traits>
+const typename RobinHoodHashTable<Traits>::AllocatorType& RobinHoodHashTable<Traits>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Traits>
+float RobinHoodHashTable<Traits>::GetLoadFactor() const
+{
+	return mCapacity != 0 ? static_cast<float>(mSize) / static_cast<float>(mCapacity) : 0.f;
+}
+
+template<class Traits>
+float RobinHoodHashTable<Traits>::GetMaxLoadFactor() const
+{
+	return mMaxLoadFactor;
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::SetMaxLoadFactor(float LoadFactor)
+{
+	mMaxLoadFactor = LoadFactor < MinMaxLoadFactor ? MinMaxLoadFactor : LoadFactor > MaxMaxLoadFactor ? MaxMaxLoadFactor : LoadFactor;
+	mMaxSize = GetMaxSize(mCapacity);
+
+	if (mSize > mMaxSize)
+	{
+		RehashNodes(GetMinCapacity(mSize));
+	}
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::Rehash(size_t Capacity)
+{
+	if (Capacity < mSize)
+	{
+		Capacity = mSize;
+	}
+
+	if (Capacity == 0)
+	{
+		DeallocateNodes(mNodes);
+
+		mNodes = nullptr;
+		mCapacity = 0;
+		mNodeCount = 0;
+		mMaxSize = 0;
+	}
+	else
+	{
+		size_t NewCapacity = GetMinCapacity(Capacity);
+		if (NewCapacity != mCapacity)
+		{
+			RehashNodes(NewCapacity);
+		}
+	}
+}
+
+template<class Traits>
+template<class K>
+size_t RobinHoodHashTable<Traits>::FindIndex(const K& InKey, size_t Hash) const
+{
+	if (mSize == 0)
+	{
+		return mNodeCount;
+	}
+
+	size_t Index = GetHomeIndex(Hash);
+	uint32_t Distance = 1;
+
+	// Elements with greater distance belong to earlier home slots. An element with smaller distance (or an empty
+	// slot) means the searched key would've displaced it, so the key is not in the table.
+	while (Distance <= mNodes[Index].Distance)
+	{
+		if (Distance == mNodes[Index].Distance && Traits::IsEqual(Traits::GetKey(mNodes[Index].Element), InKey))
+		{
+			return Index;
+		}
+
+		Index++;
+		Distance++;
+	}
+
+	return mNodeCount;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::FindRunEnd(size_t Index) const
+{
+	const KeyType& RunKey = Traits::GetKey(mNodes[Index].Element);
+
+	// Equal keys share the home slot, so their distances grow by one.
+	size_t Last = Index + 1;
+	while (mNodes[Last].Distance == mNodes[Index].Distance + (Last - Index) && Traits::IsEqual(Traits::GetKey(mNodes[Last].Element), RunKey))
+	{
+		Last++;
+	}
+
+	return Last;
+}
+
+template<class Traits>
+Pair<size_t, bool> RobinHoodHashTable<Traits>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	if (mCapacity == 0)
+	{
+		RehashNodes(MinCapacity);
+	}
+
+	while (true)
+	{
+		size_t Index = GetHomeIndex(Hash);
+		uint32_t Distance = 1;
+
+		while (Distance <= mNodes[Index].Distance)
+		{
+			if (Distance == mNodes[Index].Distance && Traits::IsEqual(Traits::GetKey(mNodes[Index].Element), InKey))
+			{
+				if constexpr (Traits::IsUnique)
+				{
+					return { Index, false };
+				}
+				else
+				{
+					// Insert after the equal keys to keep them contiguous.
+					size_t RunEnd = FindRunEnd(Index);
+					Distance += static_cast<uint32_t>(RunEnd - Index);
+					Index = RunEnd;
+					break;
+				}
+			}
+
+			Index++;
+			Distance++;
+		}
+
+		if (mSize >= mMaxSize)
+		{
+			RehashNodes(mCapacity * 2);
+			continue;
+		}
+
+		PrepareInsert(Index, Distance);
+		mSize++;
+
+		return { Index, true };
+	}
+}
+
+template<class Traits>
+bool RobinHoodHashTable<Traits>::IsFull() const
+{
+	return mCapacity != 0 && mSize >= mMaxSize;
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::Prefetch(size_t Hash) const
+{
+	if (mCapacity != 0)
+	{
+		KW_PREFETCH(mNodes + GetHomeIndex(Hash));
+	}
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::EraseIndex(size_t Index)
+{
+	mNodes[Index].Element.~ElementType();
+
+	// Displaced elements that follow move one slot closer to their home slots. An empty slot, an element in its
+	// home slot, or the sentinel ends the run.
+	size_t Last = Index + 1;
+	while (mNodes[Last].Distance > 1)
+	{
+		Last++;
+	}
+
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(mNodes + Index, mNodes + Index + 1, sizeof(Node) * (Last - Index - 1));
+	}
+	else
+	{
+		for (size_t i = Index + 1; i < Last; i++)
+		{
+			new (&mNodes[i - 1].Element) ElementType(Move(mNodes[i].Element));
+			mNodes[i].Element.~ElementType();
+			mNodes[i - 1].Distance = mNodes[i].Distance;
+		}
+	}
+
+	for (size_t i = Index; i + 1 < Last; i++)
+	{
+		mNodes[i].Distance--;
+	}
+
+	mNodes[Last - 1].Distance = Empty;
+	mSize--;
+
+	// The element that followed the erased one was either shifted into its slot or left where it was.
+	return SkipEmpty(Index);
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::EraseRun(size_t Index, size_t Count)
+{
+	for (size_t i = Index; i < Index + Count; i++)
+	{
+		mNodes[i].Element.~ElementType();
+	}
+
+	// Displaced elements that follow move back by up to the length of the run, but not past their home slots. They're
+	// sorted by home slot, so every one of them lands after the previous one. Erasing elements one by one would shift
+	// the same elements once per erased element instead.
+	size_t Free = Index;
+	size_t Last = Index + Count;
+	while (Free < Last && mNodes[Last].Distance > 1)
+	{
+		size_t HomeIndex = Last - (mNodes[Last].Distance - 1);
+		size_t Target = HomeIndex > Free ? HomeIndex : Free;
+
+		for (; Free < Target; Free++)
+		{
+			mNodes[Free].Distance = Empty;
+		}
+
+		if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+		{
+			Memory::Memcpy(&mNodes[Target].Element, &mNodes[Last].Element, sizeof(ElementType));
+		}
+		else
+		{
+			new (&mNodes[Target].Element) ElementType(Move(mNodes[Last].Element));
+			mNodes[Last].Element.~ElementType();
+		}
+		mNodes[Target].Distance = static_cast<uint32_t>(Target - HomeIndex + 1);
+
+		Free = Target + 1;
+		Last++;
+	}
+
+	for (; Free < Last; Free++)
+	{
+		mNodes[Free].Distance = Empty;
+	}
+
+	mSize -= Count;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::SkipEmpty(size_t Index) const
+{
+	// The sentinel after the last slot stops the loop.
+	while (mNodes[Index].Distance == Empty)
+	{
+		Index++;
+	}
+
+	return Index;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetEndIndex() const
+{
+	return mNodeCount;
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ElementType& RobinHoodHashTable<Traits>::GetElement(size_t Index)
+{
+	return mNodes[Index].Element;
+}
+
+template<class Traits>
+const typename RobinHoodHashTable<Traits>::ElementType& RobinHoodHashTable<Traits>::GetElement(size_t Index) const
+{
+	return mNodes[Index].Element;
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Iterator RobinHoodHashTable<Traits>::MakeIterator(size_t Index)
+{
+	return Iterator(mNodes + Index);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ConstIterator RobinHoodHashTable<Traits>::MakeIterator(size_t Index) const
+{
+	return ConstIterator(mNodes + Index);
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetIndex(ConstIterator Position) const
+{
+	return Position.mNode - mNodes;
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Iterator RobinHoodHashTable<Traits>::GetBegin()
+{
+	return Iterator(mNodes != nullptr ? mNodes + SkipEmpty(0) : nullptr);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ConstIterator RobinHoodHashTable<Traits>::GetBegin() const
+{
+	return ConstIterator(mNodes != nullptr ? mNodes + SkipEmpty(0) : nullptr);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Iterator RobinHoodHashTable<Traits>::GetEnd()
+{
+	return Iterator(mNodes + mNodeCount);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ConstIterator RobinHoodHashTable<Traits>::GetEnd() const
+{
+	return ConstIterator(mNodes + mNodeCount);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Iterator RobinHoodHashTable<Traits>::GetLast()
+{
+	// The sentinel before the first slot stops the decrement of an empty table's end iterator.
+	return mNodes != nullptr ? --GetEnd() : Iterator(nullptr);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ConstIterator RobinHoodHashTable<Traits>::GetLast() const
+{
+	return mNodes != nullptr ? --GetEnd() : ConstIterator(nullptr);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Iterator RobinHoodHashTable<Traits>::GetBeforeBegin()
+{
+	return Iterator(mNodes != nullptr ? mNodes - 1 : nullptr);
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::ConstIterator RobinHoodHashTable<Traits>::GetBeforeBegin() const
+{
+	return ConstIterator(mNodes != nullptr ? mNodes - 1 : nullptr);
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetMaxSize(size_t Capacity) const
+{
+	return static_cast<size_t>(static_cast<double>(Capacity) * mMaxLoadFactor);
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetMinCapacity(size_t Size) const
+{
+	size_t Capacity = MinCapacity;
+	while (GetMaxSize(Capacity) < Size)
+	{
+		Capacity *= 2;
+	}
+
+	return Capacity;
+}
+
+template<class Traits>
+size_t RobinHoodHashTable<Traits>::GetHomeIndex(size_t Hash) const
+{
+	// Fibonacci hashing. The top bits of the product depend on all bits of the hash, so even an identity hash of
+	// integers spreads evenly over a power of two table.
+	return static_cast<size_t>((static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(mCapacity)));
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::PrepareInsert(size_t Index, uint32_t Distance)
+{
+	size_t EmptyIndex = Index;
+	while (EmptyIndex < mNodeCount && mNodes[EmptyIndex].Distance != Empty)
+	{
+		EmptyIndex++;
+	}
+
+	if (EmptyIndex == mNodeCount)
+	{
+		ExtendOverflow();
+	}
+
+	// Shift [Index, EmptyIndex) one slot forward. Elements stay sorted by home slot, each one moves away from it.
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(mNodes + Index + 1, mNodes + Index, sizeof(Node) * (EmptyIndex - Index));
+
+		for (size_t i = Index + 1; i <= EmptyIndex; i++)
+		{
+			mNodes[i].Distance++;
+		}
+	}
+	else
+	{
+		for (size_t i = EmptyIndex; i > Index; i--)
+		{
+			new (&mNodes[i].Element) ElementType(Move(mNodes[i - 1].Element));
+			mNodes[i - 1].Element.~ElementType();
+			mNodes[i].Distance = mNodes[i - 1].Distance + 1;
+		}
+	}
+
+	mNodes[Index].Distance = Distance;
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::RehashNodes(size_t Capacity)
+{
+	Node* OldNodes = mNodes;
+	size_t OldNodeCount = mNodeCount;
+
+	mCapacity = Capacity;
+	mNodeCount = Capacity + (Capacity < MaxOverflow ? Capacity : MaxOverflow);
+	mNodes = AllocateNodes(mNodeCount);
+	mMaxSize = GetMaxSize(Capacity);
+
+	// Old elements are sorted by their old home slots. When the table grows, these are the upper bits of the new ones,
+	// so most of the elements are appended to the end of their runs without shifting.
+	for (size_t i = 0; i < OldNodeCount; i++)
+	{
+		if (OldNodes[i].Distance != Empty)
+		{
+			size_t Index = GetHomeIndex(Traits::GetHash(Traits::GetKey(OldNodes[i].Element)));
+			uint32_t Distance = 1;
+
+			while (Distance <= mNodes[Index].Distance)
+			{
+				Index++;
+				Distance++;
+			}
+
+			PrepareInsert(Index, Distance);
+
+			new (&mNodes[Index].Element) ElementType(Move(OldNodes[i].Element));
+			OldNodes[i].Element.~ElementType();
+		}
+	}
+
+	DeallocateNodes(OldNodes);
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::ExtendOverflow()
+{
+	Node* OldNodes = mNodes;
+	size_t OldNodeCount = mNodeCount;
+
+	// Only happens with long runs near the end of the table, e.g. when many keys have the same hash.
+	mNodeCount += mNodeCount - mCapacity;
+	mNodes = AllocateNodes(mNodeCount);
+
+	for (size_t i = 0; i < OldNodeCount; i++)
+	{
+		if (OldNodes[i].Distance != Empty)
+		{
+			new (&mNodes[i].Element) ElementType(Move(OldNodes[i].Element));
+			OldNodes[i].Element.~ElementType();
+			mNodes[i].Distance = OldNodes[i].Distance;
+		}
+	}
+
+	DeallocateNodes(OldNodes);
+}
+
+template<class Traits>
+template<class OtherTable>
+void RobinHoodHashTable<Traits>::CopyNodes(const OtherTable& Other)
+{
+	mMaxLoadFactor = Other.mMaxLoadFactor;
+
+	if (Other.mSize > 0)
+	{
+		// Same hash and the same number of home slots give the same layout, so no rehashing is needed.
+		mCapacity = Other.mCapacity;
+		mNodeCount = Other.mNodeCount;
+		mMaxSize = Other.mMaxSize;
+		mNodes = AllocateNodes(mNodeCount);
+
+		if constexpr (TypeTraits::IsTriviallyCopyable<ElementType>)
+		{
+			Memory::Memcpy(mNodes, Other.mNodes, sizeof(Node) * mNodeCount);
+		}
+		else
+		{
+			for (size_t i = 0; i < mNodeCount; i++)
+			{
+				if (Other.mNodes[i].Distance != Empty)
+				{
+					new (&mNodes[i].Element) ElementType(Other.mNodes[i].Element);
+					mNodes[i].Distance = Other.mNodes[i].Distance;
+				}
+			}
+		}
+
+		mSize = Other.mSize;
+	}
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::DestroyElements()
+{
+	if constexpr (!TypeTraits::IsTriviallyDestructible<ElementType>)
+	{
+		for (size_t i = 0; i < mNodeCount; i++)
+		{
+			if (mNodes[i].Distance != Empty)
+			{
+				mNodes[i].Element.~ElementType();
+			}
+		}
+	}
+}
+
+template<class Traits>
+typename RobinHoodHashTable<Traits>::Node* RobinHoodHashTable<Traits>::AllocateNodes(size_t NodeCount)
+{
+	Node* Nodes = NodeAllocator(GetAllocator()).Allocate(NodeCount + 2) + 1;
+
+	Nodes[-1].Distance = Sentinel;
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		Nodes[i].Distance = Empty;
+	}
+	Nodes[NodeCount].Distance = Sentinel;
+
+	return Nodes;
+}
+
+template<class Traits>
+void RobinHoodHashTable<Traits>::DeallocateNodes(Node* Nodes)
+{
+	if (Nodes != nullptr)
+	{
+		NodeAllocator(GetAllocator()).Deallocate(Nodes - 1);
+	}
+}
+
+} // namespace kw
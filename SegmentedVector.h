@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Iterators.h"
+#include "MallocAllocator.h"
+#include "Utility.h"
+#include "Vector.h"
+
+#include <bit>
+#include <initializer_list>
+
+namespace kw
+{
+
+// Random access iterator over elements of `SegmentedVector`. Provides the same operations as `RandomAccessIterator`,
+// but elements are not contiguous, so it's not treated as `Iterators::IsRandomAccessIterator` to avoid Memcpy paths.
+template <class T, size_t ChunkSize>
+class SegmentedIterator
+{
+public:
+    using ValueType = T;
+
+    SegmentedIterator() = default;
+    SegmentedIterator(T* const* chunks, size_t index);
+    SegmentedIterator(const SegmentedIterator<TypeTraits::RemoveConst<T>, ChunkSize>& iterator);
+
+    ValueType& operator*() const;
+    ValueType* operator->() const;
+
+    SegmentedIterator& operator++();
+    SegmentedIterator operator++(int);
+
+    SegmentedIterator& operator--();
+    SegmentedIterator operator--(int);
+
+    SegmentedIterator& operator+=(size_t delta);
+    SegmentedIterator& operator-=(size_t delta);
+
+    template <class U, size_t N>
+    friend SegmentedIterator<U, N> operator+(const SegmentedIterator<U, N>& lhs, size_t rhs);
+
+    template <class U, size_t N>
+    friend SegmentedIterator<U, N> operator+(size_t lhs, const SegmentedIterator<U, N>& rhs);
+
+    template <class U, size_t N>
+    friend SegmentedIterator<U, N> operator-(const SegmentedIterator<U, N>& lhs, size_t rhs);
+
+    template <class U, size_t N>
+    friend ptrdiff_t operator-(const SegmentedIterator<U, N>& lhs, const SegmentedIterator<U, N>& rhs);
+
+    friend auto operator<=>(const SegmentedIterator& lhs, const SegmentedIterator& rhs) = default;
+
+private:
+    template <class U, size_t N>
+    friend class SegmentedIterator;
+
+    T* const* m_chunks;
+    size_t m_index;
+};
+
+// A dynamic array that stores its elements in fixed-size chunks of `ChunkSize` elements. Unlike `Vector`, elements
+// never move when the container grows, so pointers and references to elements stay valid until the element is
+// removed. Indexed access is O(1): one extra indirection through the chunk table. Growth invalidates iterators.
+// Elements can only be added and removed at the end.
+template <class T, size_t ChunkSize = 512, class Allocator = MallocAllocator<T>>
+class SegmentedVector : protected Allocator
+{
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "Chunk size must be a power of two.");
+
+public:
+    using ValueType = T;
+    using AllocatorType = Allocator;
+
+    using Iterator = SegmentedIterator<T, ChunkSize>;
+    using ConstIterator = SegmentedIterator<const T, ChunkSize>;
+    using ReverseIterator = ::kw::ReverseIterator<Iterator>;
+    using ConstReverseIterator = ::kw::ReverseIterator<ConstIterator>;
+
+    // Construct an empty container.
+    explicit SegmentedVector(const Allocator& InAllocator = Allocator());
+
+    // Construct a container with the given number of default-constructed elements.
+    explicit SegmentedVector(size_t Size, const Allocator& InAllocator = Allocator());
+
+    // Construct a container with the given number of copies of the specified object.
+    SegmentedVector(size_t Size, const T& Value, const Allocator& InAllocator = Allocator());
+
+    // Construct a container from the given list of objects.
+    SegmentedVector(std::initializer_list<T> List, const Allocator& InAllocator = Allocator());
+
+    // Construct a container from the given range of objects. The range must be valid.
+    template <ForwardIterator<T> InIterator>
+    SegmentedVector(InIterator First, InIterator Last, const Allocator& InAllocator = Allocator());
+
+    // Construct a copy of the given container.
+    SegmentedVector(const SegmentedVector& Other) requires CopyConstructible<T>;
+
+    // Construct a container from the given container using move semantics. Elements are not moved.
+    SegmentedVector(SegmentedVector&& Other);
+
+    // Destroy all elements and deallocate all chunks.
+    ~SegmentedVector();
+
+    // Replace all elements of the container with copies of the given container's elements.
+    SegmentedVector& operator=(const SegmentedVector& Other) requires CopyConstructible<T>;
+
+    // Replace all elements of the container with the given container's elements using move semantics.
+    SegmentedVector& operator=(SegmentedVector&& Other);
+
+    // Resize the container to the given Size. New elements are default-constructed.
+    void Resize(size_t Size);
+
+    // Resize the container to the given Size. New elements are copied from the specified object.
+    void Resize(size_t Size, const T& Value);
+
+    // Allocate chunks for at least the given number of elements in the container.
+    // If the current capacity is already equal or greater, the function does nothing.
+    void Reserve(size_t Capacity);
+
+    // Clear the container. Chunks are kept allocated.
+    void Clear();
+
+    // Add an element to the end.
+    void PushBack(const T& Value);
+    void PushBack(T&& Value);
+
+    // Construct an element in-place at the end.
+    template <class... Args>
+    T& EmplaceBack(Args&&... Args);
+
+    // Remove the last element. The container must not be empty.
+    void PopBack();
+
+    // Return an element with given index. Index must be less than the container's size.
+    T& operator[](size_t Index);
+    const T& operator[](size_t Index) const;
+
+    // Return an iterator to the beginning.
+    Iterator GetBegin();
+    ConstIterator GetBegin() const;
+    ConstIterator GetConstBegin() const;
+
+    // Return an iterator to the end.
+    Iterator GetEnd();
+    ConstIterator GetEnd() const;
+    ConstIterator GetConstEnd() const;
+
+    // Return a reverse iterator to the beginning.
+    ReverseIterator GetReverseBegin();
+    ConstReverseIterator GetReverseBegin() const;
+    ConstReverseIterator GetConstReverseBegin() const;
+
+    // Return a reverse iterator to the end.
+    ReverseIterator GetReverseEnd();
+    ConstReverseIterator GetReverseEnd() const;
+    ConstReverseIterator GetConstReverseEnd() const;
+
+    // These are for ranged-based for loop support. Please don't use them since they violate the code style.
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+
+    // Return whether the container is empty.
+    bool IsEmpty() const;
+
+    // Return how many elements are stored in the container.
+    size_t GetSize() const;
+
+    // Return how many elements are allocated in the container.
+    size_t GetCapacity() const;
+
+    // Return the first element. The container must not be empty.
+    T& GetFront();
+    const T& GetFront() const;
+
+    // Return the last element. The container must not be empty.
+    T& GetBack();
+    const T& GetBack() const;
+
+    // Return the associated allocator.
+    const Allocator& GetAllocator() const;
+
+protected:
+    static constexpr size_t ChunkShift = std::countr_zero(ChunkSize);
+
+    T* GetAddress(size_t Index) const;
+    void AddChunk();
+
+    // Call the given function for every contiguous piece of the range [First, Last) with its address, index and size.
+    template <class Function>
+    void ForEachSegment(size_t First, size_t Last, Function&& Callback) const;
+
+    void DestroyAllAndDeallocate();
+
+    // Chunk table. Chunks themselves are allocated with `Allocator`.
+    Vector<T*> m_chunks;
+    size_t m_size;
+};
+
+} // namespace kw
+
+#include "SegmentedVectorImpl.h"
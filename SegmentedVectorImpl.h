@@ -0,0 +1,582 @@
+#pragma once
+
+#include "SegmentedVector.h"
+
+namespace kw {
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>::SegmentedIterator(T* const* chunks, size_t index)
+    : m_chunks(chunks)
+    , m_index(index)
+{
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>::SegmentedIterator(const SegmentedIterator<TypeTraits::RemoveConst<T>, ChunkSize>& iterator)
+    : m_chunks(iterator.m_chunks)
+    , m_index(iterator.m_index)
+{
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>::ValueType& SegmentedIterator<T, ChunkSize>::operator*() const
+{
+    return m_chunks[m_index / ChunkSize][m_index % ChunkSize];
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>::ValueType* SegmentedIterator<T, ChunkSize>::operator->() const
+{
+    return m_chunks[m_index / ChunkSize] + m_index % ChunkSize;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>& SegmentedIterator<T, ChunkSize>::operator++()
+{
+    m_index++;
+    return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize> SegmentedIterator<T, ChunkSize>::operator++(int)
+{
+    SegmentedIterator result(m_chunks, m_index);
+    m_index++;
+    return result;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>& SegmentedIterator<T, ChunkSize>::operator--()
+{
+    m_index--;
+    return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize> SegmentedIterator<T, ChunkSize>::operator--(int)
+{
+    SegmentedIterator result(m_chunks, m_index);
+    m_index--;
+    return result;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>& SegmentedIterator<T, ChunkSize>::operator+=(size_t delta)
+{
+    m_index += delta;
+    return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize>& SegmentedIterator<T, ChunkSize>::operator-=(size_t delta)
+{
+    m_index -= delta;
+    return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize> operator+(const SegmentedIterator<T, ChunkSize>& lhs, size_t rhs)
+{
+    return SegmentedIterator<T, ChunkSize>(lhs.m_chunks, lhs.m_index + rhs);
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize> operator+(size_t lhs, const SegmentedIterator<T, ChunkSize>& rhs)
+{
+    return SegmentedIterator<T, ChunkSize>(rhs.m_chunks, lhs + rhs.m_index);
+}
+
+template <typename T, size_t ChunkSize>
+inline SegmentedIterator<T, ChunkSize> operator-(const SegmentedIterator<T, ChunkSize>& lhs, size_t rhs)
+{
+    return SegmentedIterator<T, ChunkSize>(lhs.m_chunks, lhs.m_index - rhs);
+}
+
+template <typename T, size_t ChunkSize>
+inline ptrdiff_t operator-(const SegmentedIterator<T, ChunkSize>& lhs, const SegmentedIterator<T, ChunkSize>& rhs)
+{
+    return static_cast<ptrdiff_t>(lhs.m_index - rhs.m_index);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(const Allocator& allocator)
+    : Allocator(allocator)
+    , m_size(0)
+{
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(size_t count, const Allocator& allocator)
+    : Allocator(allocator)
+    , m_size(0)
+{
+    Resize(count);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(size_t count, const T& value, const Allocator& allocator)
+    : Allocator(allocator)
+    , m_size(0)
+{
+    Resize(count, value);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(std::initializer_list<T> list, const Allocator& allocator)
+    : SegmentedVector(list.begin(), list.end(), allocator)
+{
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <ForwardIterator<T> InIterator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(InIterator first, InIterator last, const Allocator& allocator)
+    : Allocator(allocator)
+    , m_size(0)
+{
+    size_t count = Iterators::GetDistance(first, last);
+
+    Reserve(count);
+
+    ForEachSegment(0, count, [&first](T* data, size_t /* index */, size_t size)
+    {
+        for (; size != 0; size--, data++, ++first)
+        {
+            new (data) T(*first);
+        }
+    });
+
+    m_size = count;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(const SegmentedVector& other) requires CopyConstructible<T>
+    : Allocator(other)
+    , m_size(0)
+{
+    Reserve(other.m_size);
+
+    // Both containers have the same chunk size, so every segment of this container is a segment in the other one.
+    ForEachSegment(0, other.m_size, [&other](T* data, size_t index, size_t size)
+    {
+        const T* source = other.GetAddress(index);
+
+        if constexpr (TypeTraits::IsTriviallyCopyConstructible<T>)
+        {
+            Memory::Memcpy(data, source, sizeof(T) * size);
+        }
+        else
+        {
+            for (; size != 0; size--, data++, source++)
+            {
+                new (data) T(*source);
+            }
+        }
+    });
+
+    m_size = other.m_size;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::SegmentedVector(SegmentedVector&& other)
+    : Allocator(Move(other))
+    , m_chunks(Move(other.m_chunks))
+    , m_size(other.m_size)
+{
+    other.m_size = 0;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>::~SegmentedVector()
+{
+    DestroyAllAndDeallocate();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline void SegmentedVector<T, ChunkSize, Allocator>::DestroyAllAndDeallocate()
+{
+    Clear();
+
+    for (T* chunk : m_chunks)
+    {
+        Allocator::Deallocate(chunk);
+    }
+
+    m_chunks.Clear();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>& SegmentedVector<T, ChunkSize, Allocator>::operator=(const SegmentedVector& other) requires CopyConstructible<T>
+{
+    // Currently, the allocator is not propagated from copy assignment.
+
+    if (&other != this)
+    {
+        // Keep the chunks, they're reused for the new elements.
+        Clear();
+        Reserve(other.m_size);
+
+        ForEachSegment(0, other.m_size, [&other](T* data, size_t index, size_t size)
+        {
+            const T* source = other.GetAddress(index);
+
+            if constexpr (TypeTraits::IsTriviallyCopyConstructible<T>)
+            {
+                Memory::Memcpy(data, source, sizeof(T) * size);
+            }
+            else
+            {
+                for (; size != 0; size--, data++, source++)
+                {
+                    new (data) T(*source);
+                }
+            }
+        });
+
+        m_size = other.m_size;
+    }
+
+    return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+SegmentedVector<T, ChunkSize, Allocator>& SegmentedVector<T, ChunkSize, Allocator>::operator=(SegmentedVector&& other)
+{
+    // Currently, the allocator is not propagated from move assignment.
+
+    if (&other != this)
+    {
+        DestroyAllAndDeallocate();
+
+        m_chunks = Move(other.m_chunks);
+        m_size = other.m_size;
+
+        other.m_size = 0;
+    }
+
+    return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::Resize(size_t size)
+{
+    if (size > m_size)
+    {
+        Reserve(size);
+
+        ForEachSegment(m_size, size, [](T* data, size_t /* index */, size_t count)
+        {
+            if constexpr (TypeTraits::IsTriviallyDefaultConstructible<T>)
+            {
+                Memory::Memset(data, 0, sizeof(T) * count);
+            }
+            else
+            {
+                for (; count != 0; count--, data++)
+                {
+                    new (data) T();
+                }
+            }
+        });
+
+        m_size = size;
+    }
+    else if (size < m_size)
+    {
+        ForEachSegment(size, m_size, [](T* data, size_t /* index */, size_t count)
+        {
+            if constexpr (!TypeTraits::IsTriviallyDestructible<T>)
+            {
+                for (; count != 0; count--, data++)
+                {
+                    data->~T();
+                }
+            }
+        });
+
+        m_size = size;
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::Resize(size_t size, const T& value)
+{
+    if (size > m_size)
+    {
+        Reserve(size);
+
+        ForEachSegment(m_size, size, [&value](T* data, size_t /* index */, size_t count)
+        {
+            for (; count != 0; count--, data++)
+            {
+                new (data) T(value);
+            }
+        });
+
+        m_size = size;
+    }
+    else if (size < m_size)
+    {
+        Resize(size);
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::Reserve(size_t capacity)
+{
+    size_t chunkCount = (capacity + ChunkSize - 1) >> ChunkShift;
+    if (chunkCount > m_chunks.GetSize())
+    {
+        // Only the chunk table is reallocated, elements stay where they are.
+        m_chunks.Reserve(chunkCount);
+
+        while (m_chunks.GetSize() < chunkCount)
+        {
+            AddChunk();
+        }
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline void SegmentedVector<T, ChunkSize, Allocator>::AddChunk()
+{
+    m_chunks.PushBack(Allocator::Allocate(ChunkSize));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::Clear()
+{
+    Resize(0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::PushBack(const T& value)
+{
+    if (m_size == GetCapacity())
+    {
+        AddChunk();
+    }
+
+    new (GetAddress(m_size)) T(value);
+    m_size++;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::PushBack(T&& value)
+{
+    if (m_size == GetCapacity())
+    {
+        AddChunk();
+    }
+
+    new (GetAddress(m_size)) T(Move(value));
+    m_size++;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename... Args>
+T& SegmentedVector<T, ChunkSize, Allocator>::EmplaceBack(Args&&... args)
+{
+    if (m_size == GetCapacity())
+    {
+        AddChunk();
+    }
+
+    T* result = new (GetAddress(m_size)) T(Forward<Args>(args)...);
+    m_size++;
+    return *result;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+void SegmentedVector<T, ChunkSize, Allocator>::PopBack()
+{
+    m_size--;
+
+    if constexpr (!TypeTraits::IsTriviallyDestructible<T>)
+    {
+        GetAddress(m_size)->~T();
+    }
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline T& SegmentedVector<T, ChunkSize, Allocator>::operator[](size_t index)
+{
+    return *GetAddress(index);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline const T& SegmentedVector<T, ChunkSize, Allocator>::operator[](size_t index) const
+{
+    return *GetAddress(index);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::Iterator SegmentedVector<T, ChunkSize, Allocator>::GetBegin()
+{
+    return Iterator(m_chunks.GetData(), 0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::GetBegin() const
+{
+    return ConstIterator(m_chunks.GetData(), 0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::GetConstBegin() const
+{
+    return ConstIterator(m_chunks.GetData(), 0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::Iterator SegmentedVector<T, ChunkSize, Allocator>::GetEnd()
+{
+    return Iterator(m_chunks.GetData(), m_size);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::GetEnd() const
+{
+    return ConstIterator(m_chunks.GetData(), m_size);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::GetConstEnd() const
+{
+    return ConstIterator(m_chunks.GetData(), m_size);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetReverseBegin()
+{
+    return ReverseIterator(Iterator(m_chunks.GetData(), m_size - 1));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetReverseBegin() const
+{
+    return ConstReverseIterator(ConstIterator(m_chunks.GetData(), m_size - 1));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetConstReverseBegin() const
+{
+    return ConstReverseIterator(ConstIterator(m_chunks.GetData(), m_size - 1));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetReverseEnd()
+{
+    // Index wraps around, but it's only compared and never dereferenced.
+    return ReverseIterator(Iterator(m_chunks.GetData(), static_cast<size_t>(-1)));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetReverseEnd() const
+{
+    return ConstReverseIterator(ConstIterator(m_chunks.GetData(), static_cast<size_t>(-1)));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstReverseIterator SegmentedVector<T, ChunkSize, Allocator>::GetConstReverseEnd() const
+{
+    return ConstReverseIterator(ConstIterator(m_chunks.GetData(), static_cast<size_t>(-1)));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::Iterator SegmentedVector<T, ChunkSize, Allocator>::begin()
+{
+    return GetBegin();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::begin() const
+{
+    return GetBegin();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::Iterator SegmentedVector<T, ChunkSize, Allocator>::end()
+{
+    return GetEnd();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline SegmentedVector<T, ChunkSize, Allocator>::ConstIterator SegmentedVector<T, ChunkSize, Allocator>::end() const
+{
+    return GetEnd();
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline bool SegmentedVector<T, ChunkSize, Allocator>::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline size_t SegmentedVector<T, ChunkSize, Allocator>::GetSize() const
+{
+    return m_size;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline size_t SegmentedVector<T, ChunkSize, Allocator>::GetCapacity() const
+{
+    return m_chunks.GetSize() << ChunkShift;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline T& SegmentedVector<T, ChunkSize, Allocator>::GetFront()
+{
+    return *GetAddress(0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline const T& SegmentedVector<T, ChunkSize, Allocator>::GetFront() const
+{
+    return *GetAddress(0);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline T& SegmentedVector<T, ChunkSize, Allocator>::GetBack()
+{
+    return *GetAddress(m_size - 1);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline const T& SegmentedVector<T, ChunkSize, Allocator>::GetBack() const
+{
+    return *GetAddress(m_size - 1);
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline const Allocator& SegmentedVector<T, ChunkSize, Allocator>::GetAllocator() const
+{
+    return *this;
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+inline T* SegmentedVector<T, ChunkSize, Allocator>::GetAddress(size_t index) const
+{
+    return m_chunks[index >> ChunkShift] + (index & (ChunkSize - 1));
+}
+
+template <typename T, size_t ChunkSize, typename Allocator>
+template <typename Function>
+inline void SegmentedVector<T, ChunkSize, Allocator>::ForEachSegment(size_t first, size_t last, Function&& callback) const
+{
+    while (first != last)
+    {
+        size_t offset = first & (ChunkSize - 1);
+        size_t count = ChunkSize - offset;
+        if (count > last - first)
+        {
+            count = last - first;
+        }
+
+        callback(m_chunks[first >> ChunkShift] + offset, first, count);
+
+        first += count;
+    }
+}
+
+} // namespace kw
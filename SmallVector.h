@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace kw
+{
+
+// Allocator adapter that owns inline storage for `N` elements of type `T`. `SmallVector` points its data at the inline
+// storage until it outgrows it. The inline storage is never returned from `Allocate`, all allocations are forwarded
+// to the given allocator. `Reallocate`, `TryExpand`, and `Deallocate` handle the inline storage address.
+template <class T, size_t N, class Allocator>
+class InlineAllocator : public Allocator
+{
+public:
+    InlineAllocator(const Allocator& allocator);
+
+    // Only the underlying allocator is copied, the inline storage is not.
+    InlineAllocator(const InlineAllocator& other);
+
+    T* Reallocate(T* address, size_t oldCount, size_t newCount) requires ReallocatableAllocator<Allocator, T>;
+    bool TryExpand(T* address, size_t oldCount, size_t newCount) requires ExpandableAllocator<Allocator, T>;
+    void Deallocate(T* address);
+
+    // Return the address of the inline storage.
+    T* GetInlineData();
+    const T* GetInlineData() const;
+
+private:
+    alignas(T) unsigned char m_storage[sizeof(T) * N];
+};
+
+// A `Vector` that stores up to `N` elements inline and only allocates memory once it outgrows the inline storage.
+// Provides the same interface as `Vector`. Unlike `Vector`, moving a container that stores its elements inline
+// moves the elements one by one.
+template <class T, size_t N, class Allocator = MallocAllocator<T>, class GrowthPolicy = DoublingGrowthPolicy>
+class SmallVector : public Vector<T, InlineAllocator<T, N, Allocator>, GrowthPolicy>
+{
+    static_assert(N > 0, "Inline capacity must be greater than zero.");
+
+public:
+    using BaseType = Vector<T, InlineAllocator<T, N, Allocator>, GrowthPolicy>;
+
+    // Construct an empty container.
+    explicit SmallVector(const Allocator& InAllocator = Allocator());
+
+    // Construct a container with the given number of default-constructed elements.
+    explicit SmallVector(size_t Size, const Allocator& InAllocator = Allocator());
+
+    // Construct a container with the given number of copies of the specified object.
+    SmallVector(size_t Size, const T& Value, const Allocator& InAllocator = Allocator());
+
+    // Construct a container from the given list of objects.
+    SmallVector(std::initializer_list<T> List, const Allocator& InAllocator = Allocator());
+
+    // Construct a container from the given range of objects. The range must be valid.
+    template <class InIterator>
+    SmallVector(InIterator First, InIterator Last, const Allocator& InAllocator = Allocator());
+
+    // Construct a copy of the given container.
+    SmallVector(const SmallVector& Other) requires CopyConstructible<T>;
+
+    // Construct a container from the given container using move semantics. If the given container stores its elements
+    // inline, the elements are moved one by one.
+    SmallVector(SmallVector&& Other);
+
+    // Replace all elements of the container with copies of the given container's elements.
+    SmallVector& operator=(const SmallVector& Other) requires CopyConstructible<T>;
+
+    // Replace all elements of the container with the given container's elements using move semantics.
+    SmallVector& operator=(SmallVector&& Other);
+
+    // Replace all elements of the container with the given list of objects.
+    SmallVector& operator=(std::initializer_list<T> List);
+
+    // Return whether the elements are stored in the inline storage.
+    bool IsInline() const;
+
+    // Return how many elements can be stored without allocating memory.
+    static constexpr size_t GetInlineCapacity();
+
+protected:
+    void ResetToInline();
+    void MoveFrom(SmallVector& Other);
+};
+
+} // namespace kw
+
+#include "SmallVectorImpl.h"
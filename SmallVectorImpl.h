@@ -0,0 +1,206 @@
+#pragma once
+
+#include "SmallVector.h"
+
+namespace kw {
+
+template <typename T, size_t N, typename Allocator>
+InlineAllocator<T, N, Allocator>::InlineAllocator(const Allocator& allocator)
+    : Allocator(allocator)
+{
+}
+
+template <typename T, size_t N, typename Allocator>
+InlineAllocator<T, N, Allocator>::InlineAllocator(const InlineAllocator& other)
+    : Allocator(other)
+{
+}
+
+template <typename T, size_t N, typename Allocator>
+T* InlineAllocator<T, N, Allocator>::Reallocate(T* address, size_t oldCount, size_t newCount) requires ReallocatableAllocator<Allocator, T>
+{
+    if (address == GetInlineData())
+    {
+        // The inline storage can't be reallocated, copy its bytes to a new block instead.
+        T* result = Allocator::Allocate(newCount);
+        Memory::Memcpy(result, address, sizeof(T) * (oldCount < newCount ? oldCount : newCount));
+        return result;
+    }
+
+    return Allocator::Reallocate(address, oldCount, newCount);
+}
+
+template <typename T, size_t N, typename Allocator>
+bool InlineAllocator<T, N, Allocator>::TryExpand(T* address, size_t oldCount, size_t newCount) requires ExpandableAllocator<Allocator, T>
+{
+    if (address == GetInlineData())
+    {
+        return newCount <= N;
+    }
+
+    return Allocator::TryExpand(address, oldCount, newCount);
+}
+
+template <typename T, size_t N, typename Allocator>
+void InlineAllocator<T, N, Allocator>::Deallocate(T* address)
+{
+    if (address != GetInlineData())
+    {
+        Allocator::Deallocate(address);
+    }
+}
+
+template <typename T, size_t N, typename Allocator>
+inline T* InlineAllocator<T, N, Allocator>::GetInlineData()
+{
+    return reinterpret_cast<T*>(m_storage);
+}
+
+template <typename T, size_t N, typename Allocator>
+inline const T* InlineAllocator<T, N, Allocator>::GetInlineData() const
+{
+    return reinterpret_cast<const T*>(m_storage);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(const Allocator& allocator)
+    : BaseType(InlineAllocator<T, N, Allocator>(allocator))
+{
+    ResetToInline();
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(size_t count, const Allocator& allocator)
+    : BaseType(InlineAllocator<T, N, Allocator>(allocator))
+{
+    ResetToInline();
+
+    // Stays in the inline storage when `count` is small enough.
+    BaseType::Resize(count);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(size_t count, const T& value, const Allocator& allocator)
+    : BaseType(InlineAllocator<T, N, Allocator>(allocator))
+{
+    ResetToInline();
+
+    BaseType::Resize(count, value);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(std::initializer_list<T> list, const Allocator& allocator)
+    : BaseType(InlineAllocator<T, N, Allocator>(allocator))
+{
+    ResetToInline();
+
+    BaseType::Reserve(list.size());
+    BaseType::CopyConstructRange(this->m_data, list.begin(), list.size());
+    this->m_size = list.size();
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <typename InIterator>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(InIterator first, InIterator last, const Allocator& allocator)
+    : BaseType(InlineAllocator<T, N, Allocator>(allocator))
+{
+    ResetToInline();
+
+    size_t count = Iterators::GetDistance(first, last);
+
+    BaseType::Reserve(count);
+    BaseType::IteratorConstructRange(this->m_data, first, count);
+    this->m_size = count;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(const SmallVector& other) requires CopyConstructible<T>
+    : BaseType(other.GetAllocator())
+{
+    ResetToInline();
+
+    BaseType::Reserve(other.m_size);
+    BaseType::CopyConstructRange(this->m_data, other.m_data, other.m_size);
+    this->m_size = other.m_size;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(SmallVector&& other)
+    : BaseType(other.GetAllocator())
+{
+    MoveFrom(other);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>& SmallVector<T, N, Allocator, GrowthPolicy>::operator=(const SmallVector& other) requires CopyConstructible<T>
+{
+    // Reuses the current storage when it's big enough, the inline storage is never deallocated.
+    BaseType::operator=(other);
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>& SmallVector<T, N, Allocator, GrowthPolicy>::operator=(SmallVector&& other)
+{
+    // Currently, the allocator is not propagated from move assignment.
+
+    if (&other != this)
+    {
+        BaseType::DestroyAllAndDeallocate();
+        MoveFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+SmallVector<T, N, Allocator, GrowthPolicy>& SmallVector<T, N, Allocator, GrowthPolicy>::operator=(std::initializer_list<T> list)
+{
+    BaseType::operator=(list);
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::MoveFrom(SmallVector& other)
+{
+    if (other.IsInline())
+    {
+        ResetToInline();
+
+        // Inline elements can't be stolen, relocate them one by one. `other` is left empty.
+        BaseType::RelocateRange(this->m_data, other.m_data, other.m_size);
+        this->m_size = other.m_size;
+
+        other.m_size = 0;
+    }
+    else
+    {
+        this->m_data = other.m_data;
+        this->m_size = other.m_size;
+        this->m_capacity = other.m_capacity;
+
+        other.ResetToInline();
+    }
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool SmallVector<T, N, Allocator, GrowthPolicy>::IsInline() const
+{
+    return this->m_data == BaseType::GetAllocator().GetInlineData();
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr size_t SmallVector<T, N, Allocator, GrowthPolicy>::GetInlineCapacity()
+{
+    return N;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::ResetToInline()
+{
+    this->m_data = InlineAllocator<T, N, Allocator>::GetInlineData();
+    this->m_size = 0;
+    this->m_capacity = N;
+}
+
+} // namespace kw
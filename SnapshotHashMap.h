@@ -0,0 +1,392 @@
+#pragma once
+
+#include "Assert.h"
+#include "HashMap.h"
+#include "HashTraits.h"
+#include "MallocAllocator.h"
+#include "Pair.h"
+#include "Utility.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace kw
+{
+
+// A hash map for data that is read far more often than it's written, e.g. configuration or routing tables. Readers
+// look up elements in an immutable version of the map without any locks or atomic read-modify-write operations, see
+// `Reader`. Each write copies the current version, changes the copy, and publishes it, so writes take time linear in
+// the size of the map. Writers wait for each other, but never for readers. Old versions are destroyed once no reader
+// can access them anymore: every reader records the epoch of the version it reads, and a version is destroyed when
+// all readers have moved to later epochs. The map must outlive its readers.
+template<class Key, class Value, class KeyHash = Hash<Key>, class KeyEqual = EqualTo<Key>, class Allocator = MallocAllocator<Pair<const Key, Value>>, class Layout = RobinHoodHashLayout>
+class SnapshotHashMap
+{
+	struct Version;
+
+public:
+	using MapType = HashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>;
+	using KeyType = Key;
+	using ValueType = Value;
+	using ElementType = typename MapType::ElementType;
+	using AllocatorType = Allocator;
+	using ConstIterator = typename MapType::ConstIterator;
+
+	// A thread's view of the map. Lookups see the version that was current when the reader was constructed or last
+	// refreshed, and iterators and references that they return stay valid until the next refresh. A reader must only
+	// be used by one thread at a time, and a thread that reads continuously should keep its reader for a long time,
+	// since constructing one takes the writers' lock.
+	class alignas(64) Reader
+	{
+	public:
+		// Constructs a reader of the current version of the given map.
+		explicit Reader(const SnapshotHashMap& InMap);
+
+		Reader(const Reader& Other) = delete;
+		Reader& operator=(const Reader& Other) = delete;
+
+		// Destroys the reader. Versions that only this reader accessed get destroyed.
+		~Reader();
+
+		// Switch to the current version of the map. Costs a single acquire load when there's no new version. A reader
+		// that is never refreshed keeps all later versions of the map alive, so refresh between unrelated batches of
+		// lookups, e.g. once per request.
+		void Refresh();
+
+		// Same as the functions of `HashMap`, but for the version this reader sees.
+		ConstIterator Find(const KeyType& InKey) const;
+		bool Contains(const KeyType& InKey) const;
+		size_t Count(const KeyType& InKey) const;
+		ConstIterator GetBegin() const;
+		ConstIterator GetEnd() const;
+		bool IsEmpty() const;
+		size_t GetSize() const;
+
+		// Return the version of the map this reader sees.
+		const MapType& GetSnapshot() const;
+
+	private:
+		friend class SnapshotHashMap;
+
+		const SnapshotHashMap& mMap;
+		const Version* mVersion;
+
+		// Epoch of `mVersion`. Only writers read it, and only this reader writes it.
+		std::atomic<uint64_t> mEpoch;
+
+		// Next reader of the same map. Guarded by the writers' lock.
+		Reader* mNext;
+	};
+
+	// Constructs an empty map.
+	SnapshotHashMap(const Allocator& InAllocator = Allocator());
+
+	SnapshotHashMap(const SnapshotHashMap& Other) = delete;
+	SnapshotHashMap& operator=(const SnapshotHashMap& Other) = delete;
+
+	// Destroys the map and all its versions. All readers must be destroyed first.
+	~SnapshotHashMap();
+
+	// Insert an element with the given key and value, or assign the given value to the element with the given key if
+	// it exists, and publish the result as a new version. Return true if the element was inserted.
+	bool InsertOrAssign(const KeyType& InKey, const ValueType& InValue);
+
+	// Remove the element with the given key, and publish the result as a new version if it existed. Return whether
+	// the element existed.
+	bool Erase(const KeyType& InKey);
+
+	// Call the given function with a copy of the current version of the map, then publish the copy as the new version.
+	// Useful to apply many changes at the cost of a single copy. The function must not access this map.
+	template<class Function>
+	void Modify(Function&& Callback);
+
+	// Return a copy of the current version of the map.
+	MapType GetCopy() const;
+
+private:
+	struct Version
+	{
+		Version(const MapType& Other);
+		Version(const Allocator& InAllocator);
+
+		MapType Map;
+		uint64_t Epoch;
+
+		// Next retired version that readers may still access. Guarded by the writers' lock.
+		Version* NextRetired;
+	};
+
+	using VersionAllocator = typename HashDetails::RebindAllocator<Allocator, Version>::Type;
+
+	// Publish the given version, retire the current one, and destroy retired versions that readers no longer access.
+	// The writers' lock must be held.
+	void Publish(Version* NewVersion);
+
+	// Destroy the retired versions older than the versions all readers access. The writers' lock must be held.
+	void Reclaim() const;
+
+	// Copy the current version for a writer. The writers' lock must be held.
+	Version* CopyCurrent();
+
+	void DestroyVersion(Version* OldVersion) const;
+
+	mutable VersionAllocator mVersionAllocator;
+
+	// Readers only ever load this, writers store it under the lock.
+	std::atomic<Version*> mCurrent;
+
+	// Serializes writers, and guards the lists of readers and retired versions.
+	mutable std::mutex mWriteMutex;
+	mutable Reader* mReaders;
+	mutable Version* mRetired;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::Reader(const SnapshotHashMap& InMap)
+	: mMap(InMap)
+	, mVersion(nullptr)
+	, mEpoch(0)
+	, mNext(nullptr)
+{
+	// Under the lock, no version can be retired between loading the current one and announcing its epoch.
+	std::lock_guard Lock(mMap.mWriteMutex);
+
+	mVersion = mMap.mCurrent.load(std::memory_order_relaxed);
+	mEpoch.store(mVersion->Epoch, std::memory_order_relaxed);
+
+	mNext = mMap.mReaders;
+	mMap.mReaders = this;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::~Reader()
+{
+	std::lock_guard Lock(mMap.mWriteMutex);
+
+	Reader** Link = &mMap.mReaders;
+	while (*Link != this)
+	{
+		Link = &(*Link)->mNext;
+	}
+	*Link = mNext;
+
+	mMap.Reclaim();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::Refresh()
+{
+	const Version* Current = mMap.mCurrent.load(std::memory_order_acquire);
+	if (Current != mVersion)
+	{
+		mVersion = Current;
+
+		// A writer that sees the new epoch destroys the older versions, so the lookups in them must happen before.
+		// A reader never announces an epoch later than the version it reads, so no fence is necessary between the
+		// load above and this store.
+		mEpoch.store(Current->Epoch, std::memory_order_release);
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ConstIterator SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::Find(const KeyType& InKey) const
+{
+	return mVersion->Map.Find(InKey);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::Contains(const KeyType& InKey) const
+{
+	return mVersion->Map.Contains(InKey);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+size_t SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::Count(const KeyType& InKey) const
+{
+	return mVersion->Map.Count(InKey);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ConstIterator SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::GetBegin() const
+{
+	return mVersion->Map.GetBegin();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::ConstIterator SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::GetEnd() const
+{
+	return mVersion->Map.GetEnd();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::IsEmpty() const
+{
+	return mVersion->Map.IsEmpty();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+size_t SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::GetSize() const
+{
+	return mVersion->Map.GetSize();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+const typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::MapType& SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reader::GetSnapshot() const
+{
+	return mVersion->Map;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Version::Version(const MapType& Other)
+	: Map(Other)
+	, Epoch(0)
+	, NextRetired(nullptr)
+{
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Version::Version(const Allocator& InAllocator)
+	: Map(InAllocator)
+	, Epoch(0)
+	, NextRetired(nullptr)
+{
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::SnapshotHashMap(const Allocator& InAllocator)
+	: mVersionAllocator(InAllocator)
+	, mCurrent(nullptr)
+	, mReaders(nullptr)
+	, mRetired(nullptr)
+{
+	Version* Initial = mVersionAllocator.Allocate(1);
+	new (Initial) Version(InAllocator);
+	mCurrent.store(Initial, std::memory_order_relaxed);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::~SnapshotHashMap()
+{
+	KW_ASSERT(mReaders == nullptr, "The map is destroyed before its readers.");
+
+	while (mRetired != nullptr)
+	{
+		Version* Next = mRetired->NextRetired;
+		DestroyVersion(mRetired);
+		mRetired = Next;
+	}
+
+	DestroyVersion(mCurrent.load(std::memory_order_relaxed));
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::InsertOrAssign(const KeyType& InKey, const ValueType& InValue)
+{
+	std::lock_guard Lock(mWriteMutex);
+
+	Version* NewVersion = CopyCurrent();
+
+	bool IsInserted = NewVersion->Map.InsertOrAssign(InKey, InValue).Value;
+
+	Publish(NewVersion);
+	return IsInserted;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+bool SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Erase(const KeyType& InKey)
+{
+	std::lock_guard Lock(mWriteMutex);
+
+	// Don't copy the map just to find out that there's nothing to erase.
+	if (!mCurrent.load(std::memory_order_relaxed)->Map.Contains(InKey))
+	{
+		return false;
+	}
+
+	Version* NewVersion = CopyCurrent();
+	NewVersion->Map.Erase(InKey);
+	Publish(NewVersion);
+	return true;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+template<class Function>
+void SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Modify(Function&& Callback)
+{
+	std::lock_guard Lock(mWriteMutex);
+
+	Version* NewVersion = CopyCurrent();
+	Callback(NewVersion->Map);
+	Publish(NewVersion);
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::MapType SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::GetCopy() const
+{
+	// Writers only destroy retired versions, and the current one can't be retired while the lock is held.
+	std::lock_guard Lock(mWriteMutex);
+	return mCurrent.load(std::memory_order_relaxed)->Map;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Publish(Version* NewVersion)
+{
+	Version* OldVersion = mCurrent.load(std::memory_order_relaxed);
+	NewVersion->Epoch = OldVersion->Epoch + 1;
+
+	// Readers that load the new version see it fully constructed.
+	mCurrent.store(NewVersion, std::memory_order_release);
+
+	OldVersion->NextRetired = mRetired;
+	mRetired = OldVersion;
+
+	Reclaim();
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Reclaim() const
+{
+	uint64_t MinEpoch = mCurrent.load(std::memory_order_relaxed)->Epoch;
+	for (Reader* It = mReaders; It != nullptr; It = It->mNext)
+	{
+		uint64_t ReaderEpoch = It->mEpoch.load(std::memory_order_acquire);
+		MinEpoch = ReaderEpoch < MinEpoch ? ReaderEpoch : MinEpoch;
+	}
+
+	// Readers only move to the current version, so none of them can get back to a version older than all of them.
+	Version** Link = &mRetired;
+	while (*Link != nullptr)
+	{
+		if ((*Link)->Epoch < MinEpoch)
+		{
+			Version* OldVersion = *Link;
+			*Link = OldVersion->NextRetired;
+			DestroyVersion(OldVersion);
+		}
+		else
+		{
+			Link = &(*Link)->NextRetired;
+		}
+	}
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+typename SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::Version* SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::CopyCurrent()
+{
+	Version* NewVersion = mVersionAllocator.Allocate(1);
+	new (NewVersion) Version(mCurrent.load(std::memory_order_relaxed)->Map);
+	return NewVersion;
+}
+
+template<class Key, class Value, class KeyHash, class KeyEqual, class Allocator, class Layout>
+void SnapshotHashMap<Key, Value, KeyHash, KeyEqual, Allocator, Layout>::DestroyVersion(Version* OldVersion) const
+{
+	OldVersion->~Version();
+	mVersionAllocator.Deallocate(OldVersion);
+}
+
+} // namespace kw
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "ArrayView.h"
+#include "Concepts.h"
+#include "Memory.h"
+#include "Utility.h"
+
+#include <tuple>
+#include <utility>
+
+namespace kw
+{
+
+// Proxy reference to an element of `SoAVector`. The element's fields are stored in separate arrays, so there's no
+// object to point to. Fields are accessed with `Get<Index>()`. Invalidated when the container reallocates.
+template <class... Ts>
+class SoAReference
+{
+public:
+    template <size_t Index>
+    using FieldType = std::tuple_element_t<Index, std::tuple<Ts...>>;
+
+    SoAReference(void* const* fields, size_t index);
+
+    // Return the field with the given index of the referenced element.
+    template <size_t Index>
+    FieldType<Index>& Get() const;
+
+private:
+    void* const* m_fields;
+    size_t m_index;
+};
+
+// Random access iterator over elements of `SoAVector`. Dereferencing returns a `SoAReference` proxy by value, so
+// there's no `operator->` and it can't be wrapped in `ReverseIterator`.
+template <class... Ts>
+class SoAIterator
+{
+public:
+    using ValueType = SoAReference<Ts...>;
+
+    SoAIterator() = default;
+    SoAIterator(void* const* fields, size_t index);
+    SoAIterator(const SoAIterator<TypeTraits::RemoveConst<Ts>...>& iterator);
+
+    ValueType operator*() const;
+
+    SoAIterator& operator++();
+    SoAIterator operator++(int);
+
+    SoAIterator& operator--();
+    SoAIterator operator--(int);
+
+    SoAIterator& operator+=(size_t delta);
+    SoAIterator& operator-=(size_t delta);
+
+    template <class... Us>
+    friend SoAIterator<Us...> operator+(const SoAIterator<Us...>& lhs, size_t rhs);
+
+    template <class... Us>
+    friend SoAIterator<Us...> operator+(size_t lhs, const SoAIterator<Us...>& rhs);
+
+    template <class... Us>
+    friend SoAIterator<Us...> operator-(const SoAIterator<Us...>& lhs, size_t rhs);
+
+    template <class... Us>
+    friend ptrdiff_t operator-(const SoAIterator<Us...>& lhs, const SoAIterator<Us...>& rhs);
+
+    friend auto operator<=>(const SoAIterator& lhs, const SoAIterator& rhs) = default;
+
+    // Return the index of the element this iterator points to.
+    size_t GetIndex() const;
+
+private:
+    template <class... Us>
+    friend class SoAIterator;
+
+    void* const* m_fields;
+    size_t m_index;
+};
+
+// A dynamic array that stores each field of its elements in a separate contiguous array ("structure of arrays"),
+// e.g. `SoAVector<Vector3, Quaternion, int>` keeps all positions, then all rotations, then all ids. Loops that only
+// touch a few fields don't pull the other fields into the cache. All field arrays live in one allocation and each
+// one is aligned to `Alignment` bytes, so they can be processed with aligned SIMD loads.
+// Growth, insertion and erasure work like in `Vector` with `DoublingGrowthPolicy`, applied to every field at once.
+template <class... Ts>
+class SoAVector
+{
+    static_assert(sizeof...(Ts) > 0, "At least one field is required.");
+
+public:
+    template <size_t Index>
+    using FieldType = std::tuple_element_t<Index, std::tuple<Ts...>>;
+
+    using Reference = SoAReference<Ts...>;
+    using ConstReference = SoAReference<const Ts...>;
+
+    using Iterator = SoAIterator<Ts...>;
+    using ConstIterator = SoAIterator<const Ts...>;
+
+    // Number of fields, i.e. number of arrays.
+    static constexpr size_t FieldCount = sizeof...(Ts);
+
+    // Alignment of every field array. Cache line size, which is also enough for AVX-512 loads.
+    static constexpr size_t Alignment = []
+    {
+        size_t result = 64;
+        ((result = alignof(Ts) > result ? alignof(Ts) : result), ...);
+        return result;
+    }();
+
+    // Construct an empty container.
+    SoAVector();
+
+    // Construct a container with the given number of default-constructed elements.
+    explicit SoAVector(size_t Size);
+
+    // Construct a container with the given number of elements, each field is a copy of the corresponding value.
+    SoAVector(size_t Size, const Ts&... Values);
+
+    // Construct a copy of the given container.
+    SoAVector(const SoAVector& Other) requires (CopyConstructible<Ts> && ...);
+
+    // Construct a container from the given container using move semantics. Elements are not moved.
+    SoAVector(SoAVector&& Other);
+
+    // Destroy all elements and deallocate the memory.
+    ~SoAVector();
+
+    // Replace all elements of the container with copies of the given container's elements.
+    SoAVector& operator=(const SoAVector& Other) requires (CopyConstructible<Ts> && ...);
+
+    // Replace all elements of the container with the given container's elements using move semantics.
+    SoAVector& operator=(SoAVector&& Other);
+
+    // Resize the container to the given Size. New elements are default-constructed.
+    void Resize(size_t Size);
+
+    // Resize the container to the given Size. Fields of new elements are copied from the corresponding values.
+    void Resize(size_t Size, const Ts&... Values);
+
+    // Allocate memory for at least the given number of elements in the container.
+    // If the current capacity is already equal or greater, the function does nothing.
+    void Reserve(size_t Capacity);
+
+    // Reduce the capacity to the container's size.
+    void ShrinkToFit();
+
+    // Clear the container. Capacity is not changed.
+    void Clear();
+
+    // Insert an element with the given fields before the specified element. `Position` must be valid.
+    Iterator Insert(ConstIterator Position, const Ts&... Values);
+
+    // Erase the specified element. `Position` must be valid.
+    Iterator Erase(ConstIterator Position);
+
+    // Erase the given range of elements. The range must be valid.
+    Iterator Erase(ConstIterator First, ConstIterator Last);
+
+    // Add an element with the given fields to the end.
+    void PushBack(const Ts&... Values);
+    void PushBack(Ts&&... Values);
+
+    // Remove the last element. The container must not be empty.
+    void PopBack();
+
+    // Return an element with given index. Index must be less than the container's size.
+    Reference operator[](size_t Index);
+    ConstReference operator[](size_t Index) const;
+
+    // Return a view over all values of the field with the given index.
+    template <size_t Index>
+    ArrayView<FieldType<Index>> GetField() const;
+
+    // Return the array of the field with the given index. May be null.
+    template <size_t Index>
+    FieldType<Index>* GetData();
+
+    template <size_t Index>
+    const FieldType<Index>* GetData() const;
+
+    // Return an iterator to the beginning.
+    Iterator GetBegin();
+    ConstIterator GetBegin() const;
+    ConstIterator GetConstBegin() const;
+
+    // Return an iterator to the end.
+    Iterator GetEnd();
+    ConstIterator GetEnd() const;
+    ConstIterator GetConstEnd() const;
+
+    // These are for ranged-based for loop support. Please don't use them since they violate the code style.
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+
+    // Return whether the container is empty.
+    bool IsEmpty() const;
+
+    // Return how many elements are stored in the container.
+    size_t GetSize() const;
+
+    // Return how many elements are allocated in the container.
+    size_t GetCapacity() const;
+
+    // Return the first element. The container must not be empty.
+    Reference GetFront();
+    ConstReference GetFront() const;
+
+    // Return the last element. The container must not be empty.
+    Reference GetBack();
+    ConstReference GetBack() const;
+
+protected:
+    using Indices = std::index_sequence_for<Ts...>;
+
+    // Compute offsets of all field arrays in one allocation for the given capacity. Return the allocation size.
+    static size_t GetLayout(size_t Capacity, size_t(&Offsets)[FieldCount]);
+
+    void ReserveUnchecked(size_t Capacity);
+    void DestroyAllAndDeallocate();
+
+    template <size_t... Is>
+    void RelocateFields(void* const* Dst, std::index_sequence<Is...>);
+
+    template <size_t... Is>
+    void DestroyFields(size_t First, size_t Last, std::index_sequence<Is...>);
+
+    template <size_t... Is>
+    void DefaultConstructFields(size_t First, size_t Last, std::index_sequence<Is...>);
+
+    template <size_t... Is>
+    void ValueConstructFields(size_t First, size_t Last, std::index_sequence<Is...>, const Ts&... Values);
+
+    template <size_t... Is>
+    void CopyConstructFields(const SoAVector& Other, std::index_sequence<Is...>);
+
+    template <size_t... Is, class... Args>
+    void ConstructFields(size_t Index, std::index_sequence<Is...>, Args&&... Values);
+
+    template <size_t... Is>
+    void InsertFields(size_t Index, std::index_sequence<Is...>, const Ts&... Values);
+
+    template <size_t... Is>
+    void EraseFields(size_t First, size_t Last, std::index_sequence<Is...>);
+
+    template <class T>
+    static void DestroyRange(T* Data, size_t Size);
+
+    template <class T>
+    static void RelocateRange(T* Dst, T* Src, size_t Size);
+
+    template <class T>
+    static void InsertValue(T* Data, size_t Size, size_t Index, const T& Value);
+
+    template <class T>
+    static void EraseRange(T* Data, size_t Size, size_t First, size_t Last);
+
+    // Every pointer points into the same allocation, the first one is the address of the allocation itself.
+    void* m_fields[FieldCount];
+    size_t m_size;
+    size_t m_capacity;
+};
+
+} // namespace kw
+
+#include "SoAVectorImpl.h"
@@ -0,0 +1,709 @@
+#pragma once
+
+#include "SoAVector.h"
+
+namespace kw {
+
+template <typename... Ts>
+inline SoAReference<Ts...>::SoAReference(void* const* fields, size_t index)
+    : m_fields(fields)
+    , m_index(index)
+{
+}
+
+template <typename... Ts>
+template <size_t Index>
+inline typename SoAReference<Ts...>::template FieldType<Index>& SoAReference<Ts...>::Get() const
+{
+    return static_cast<FieldType<Index>*>(m_fields[Index])[m_index];
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>::SoAIterator(void* const* fields, size_t index)
+    : m_fields(fields)
+    , m_index(index)
+{
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>::SoAIterator(const SoAIterator<TypeTraits::RemoveConst<Ts>...>& iterator)
+    : m_fields(iterator.m_fields)
+    , m_index(iterator.m_index)
+{
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>::ValueType SoAIterator<Ts...>::operator*() const
+{
+    return ValueType(m_fields, m_index);
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>& SoAIterator<Ts...>::operator++()
+{
+    m_index++;
+    return *this;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...> SoAIterator<Ts...>::operator++(int)
+{
+    SoAIterator result(m_fields, m_index);
+    m_index++;
+    return result;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>& SoAIterator<Ts...>::operator--()
+{
+    m_index--;
+    return *this;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...> SoAIterator<Ts...>::operator--(int)
+{
+    SoAIterator result(m_fields, m_index);
+    m_index--;
+    return result;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>& SoAIterator<Ts...>::operator+=(size_t delta)
+{
+    m_index += delta;
+    return *this;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...>& SoAIterator<Ts...>::operator-=(size_t delta)
+{
+    m_index -= delta;
+    return *this;
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...> operator+(const SoAIterator<Ts...>& lhs, size_t rhs)
+{
+    return SoAIterator<Ts...>(lhs.m_fields, lhs.m_index + rhs);
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...> operator+(size_t lhs, const SoAIterator<Ts...>& rhs)
+{
+    return SoAIterator<Ts...>(rhs.m_fields, lhs + rhs.m_index);
+}
+
+template <typename... Ts>
+inline SoAIterator<Ts...> operator-(const SoAIterator<Ts...>& lhs, size_t rhs)
+{
+    return SoAIterator<Ts...>(lhs.m_fields, lhs.m_index - rhs);
+}
+
+template <typename... Ts>
+inline ptrdiff_t operator-(const SoAIterator<Ts...>& lhs, const SoAIterator<Ts...>& rhs)
+{
+    return static_cast<ptrdiff_t>(lhs.m_index - rhs.m_index);
+}
+
+template <typename... Ts>
+inline size_t SoAIterator<Ts...>::GetIndex() const
+{
+    return m_index;
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::SoAVector()
+    : m_fields{}
+    , m_size(0)
+    , m_capacity(0)
+{
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::SoAVector(size_t count)
+    : SoAVector()
+{
+    Resize(count);
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::SoAVector(size_t count, const Ts&... values)
+    : SoAVector()
+{
+    Resize(count, values...);
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::SoAVector(const SoAVector& other) requires (CopyConstructible<Ts> && ...)
+    : SoAVector()
+{
+    if (other.m_size > 0)
+    {
+        ReserveUnchecked(other.m_size);
+        CopyConstructFields(other, Indices());
+        m_size = other.m_size;
+    }
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::SoAVector(SoAVector&& other)
+    : m_size(other.m_size)
+    , m_capacity(other.m_capacity)
+{
+    for (size_t i = 0; i < FieldCount; i++)
+    {
+        m_fields[i] = other.m_fields[i];
+        other.m_fields[i] = nullptr;
+    }
+
+    other.m_size = 0;
+    other.m_capacity = 0;
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::~SoAVector()
+{
+    DestroyAllAndDeallocate();
+}
+
+template <typename... Ts>
+SoAVector<Ts...>& SoAVector<Ts...>::operator=(const SoAVector& other) requires (CopyConstructible<Ts> && ...)
+{
+    if (&other != this)
+    {
+        Clear();
+
+        if (other.m_size > m_capacity)
+        {
+            // The container is empty, so nothing is relocated.
+            ReserveUnchecked(other.m_size);
+        }
+
+        CopyConstructFields(other, Indices());
+        m_size = other.m_size;
+    }
+
+    return *this;
+}
+
+template <typename... Ts>
+SoAVector<Ts...>& SoAVector<Ts...>::operator=(SoAVector&& other)
+{
+    if (&other != this)
+    {
+        DestroyAllAndDeallocate();
+
+        for (size_t i = 0; i < FieldCount; i++)
+        {
+            m_fields[i] = other.m_fields[i];
+            other.m_fields[i] = nullptr;
+        }
+
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    return *this;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::Resize(size_t size)
+{
+    if (size > m_size)
+    {
+        Reserve(size);
+        DefaultConstructFields(m_size, size, Indices());
+    }
+    else
+    {
+        DestroyFields(size, m_size, Indices());
+    }
+
+    m_size = size;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::Resize(size_t size, const Ts&... values)
+{
+    if (size > m_size)
+    {
+        Reserve(size);
+        ValueConstructFields(m_size, size, Indices(), values...);
+    }
+    else
+    {
+        DestroyFields(size, m_size, Indices());
+    }
+
+    m_size = size;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::Reserve(size_t capacity)
+{
+    if (capacity > m_capacity)
+    {
+        ReserveUnchecked(capacity);
+    }
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::ShrinkToFit()
+{
+    if (m_size == 0)
+    {
+        DestroyAllAndDeallocate();
+    }
+    else if (m_size < m_capacity)
+    {
+        ReserveUnchecked(m_size);
+    }
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::Clear()
+{
+    DestroyFields(0, m_size, Indices());
+    m_size = 0;
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::Iterator SoAVector<Ts...>::Insert(ConstIterator position, const Ts&... values)
+{
+    size_t index = position.GetIndex();
+
+    if (m_size == m_capacity)
+    {
+        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+    }
+
+    InsertFields(index, Indices(), values...);
+    m_size++;
+
+    return Iterator(m_fields, index);
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::Iterator SoAVector<Ts...>::Erase(ConstIterator position)
+{
+    return Erase(position, position + 1);
+}
+
+template <typename... Ts>
+SoAVector<Ts...>::Iterator SoAVector<Ts...>::Erase(ConstIterator first, ConstIterator last)
+{
+    size_t firstIndex = first.GetIndex();
+    size_t lastIndex = last.GetIndex();
+
+    if (firstIndex != lastIndex)
+    {
+        EraseFields(firstIndex, lastIndex, Indices());
+        m_size -= lastIndex - firstIndex;
+    }
+
+    return Iterator(m_fields, firstIndex);
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::PushBack(const Ts&... values)
+{
+    if (m_size == m_capacity)
+    {
+        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+    }
+
+    ConstructFields(m_size, Indices(), values...);
+    m_size++;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::PushBack(Ts&&... values)
+{
+    if (m_size == m_capacity)
+    {
+        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+    }
+
+    ConstructFields(m_size, Indices(), Move(values)...);
+    m_size++;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::PopBack()
+{
+    m_size--;
+    DestroyFields(m_size, m_size + 1, Indices());
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Reference SoAVector<Ts...>::operator[](size_t index)
+{
+    return Reference(m_fields, index);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstReference SoAVector<Ts...>::operator[](size_t index) const
+{
+    return ConstReference(m_fields, index);
+}
+
+template <typename... Ts>
+template <size_t Index>
+inline ArrayView<typename SoAVector<Ts...>::template FieldType<Index>> SoAVector<Ts...>::GetField() const
+{
+    const FieldType<Index>* data = GetData<Index>();
+    return ArrayView<FieldType<Index>>(data, data + m_size);
+}
+
+template <typename... Ts>
+template <size_t Index>
+inline typename SoAVector<Ts...>::template FieldType<Index>* SoAVector<Ts...>::GetData()
+{
+    return static_cast<FieldType<Index>*>(m_fields[Index]);
+}
+
+template <typename... Ts>
+template <size_t Index>
+inline const typename SoAVector<Ts...>::template FieldType<Index>* SoAVector<Ts...>::GetData() const
+{
+    return static_cast<const FieldType<Index>*>(m_fields[Index]);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Iterator SoAVector<Ts...>::GetBegin()
+{
+    return Iterator(m_fields, 0);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::GetBegin() const
+{
+    return ConstIterator(m_fields, 0);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::GetConstBegin() const
+{
+    return ConstIterator(m_fields, 0);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Iterator SoAVector<Ts...>::GetEnd()
+{
+    return Iterator(m_fields, m_size);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::GetEnd() const
+{
+    return ConstIterator(m_fields, m_size);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::GetConstEnd() const
+{
+    return ConstIterator(m_fields, m_size);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Iterator SoAVector<Ts...>::begin()
+{
+    return GetBegin();
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::begin() const
+{
+    return GetBegin();
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Iterator SoAVector<Ts...>::end()
+{
+    return GetEnd();
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstIterator SoAVector<Ts...>::end() const
+{
+    return GetEnd();
+}
+
+template <typename... Ts>
+inline bool SoAVector<Ts...>::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+template <typename... Ts>
+inline size_t SoAVector<Ts...>::GetSize() const
+{
+    return m_size;
+}
+
+template <typename... Ts>
+inline size_t SoAVector<Ts...>::GetCapacity() const
+{
+    return m_capacity;
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Reference SoAVector<Ts...>::GetFront()
+{
+    return Reference(m_fields, 0);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstReference SoAVector<Ts...>::GetFront() const
+{
+    return ConstReference(m_fields, 0);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::Reference SoAVector<Ts...>::GetBack()
+{
+    return Reference(m_fields, m_size - 1);
+}
+
+template <typename... Ts>
+inline SoAVector<Ts...>::ConstReference SoAVector<Ts...>::GetBack() const
+{
+    return ConstReference(m_fields, m_size - 1);
+}
+
+template <typename... Ts>
+size_t SoAVector<Ts...>::GetLayout(size_t capacity, size_t(&offsets)[FieldCount])
+{
+    constexpr size_t fieldSizes[] = { sizeof(Ts)... };
+
+    // Every array is padded to the alignment, so the next one starts aligned too.
+    size_t offset = 0;
+    for (size_t i = 0; i < FieldCount; i++)
+    {
+        offsets[i] = offset;
+        offset += (fieldSizes[i] * capacity + Alignment - 1) & ~(Alignment - 1);
+    }
+    return offset;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::ReserveUnchecked(size_t capacity)
+{
+    size_t offsets[FieldCount];
+    size_t size = GetLayout(capacity, offsets);
+
+    unsigned char* data = static_cast<unsigned char*>(Memory::Malloc(size, Alignment));
+
+    void* fields[FieldCount];
+    for (size_t i = 0; i < FieldCount; i++)
+    {
+        fields[i] = data + offsets[i];
+    }
+
+    if (m_fields[0] != nullptr)
+    {
+        RelocateFields(fields, Indices());
+        Memory::Free(m_fields[0]);
+    }
+
+    for (size_t i = 0; i < FieldCount; i++)
+    {
+        m_fields[i] = fields[i];
+    }
+
+    m_capacity = capacity;
+}
+
+template <typename... Ts>
+void SoAVector<Ts...>::DestroyAllAndDeallocate()
+{
+    DestroyFields(0, m_size, Indices());
+
+    if (m_fields[0] != nullptr)
+    {
+        Memory::Free(m_fields[0]);
+    }
+
+    for (size_t i = 0; i < FieldCount; i++)
+    {
+        m_fields[i] = nullptr;
+    }
+
+    m_size = 0;
+    m_capacity = 0;
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::RelocateFields(void* const* dst, std::index_sequence<Is...>)
+{
+    (RelocateRange(static_cast<FieldType<Is>*>(dst[Is]), GetData<Is>(), m_size), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::DestroyFields(size_t first, size_t last, std::index_sequence<Is...>)
+{
+    (DestroyRange(GetData<Is>() + first, last - first), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::DefaultConstructFields(size_t first, size_t last, std::index_sequence<Is...>)
+{
+    ([&]
+    {
+        FieldType<Is>* data = GetData<Is>() + first;
+
+        if constexpr (TypeTraits::IsTriviallyDefaultConstructible<FieldType<Is>>)
+        {
+            Memory::Memset(data, 0, sizeof(FieldType<Is>) * (last - first));
+        }
+        else
+        {
+            for (size_t count = last - first; count != 0; count--, data++)
+            {
+                new (data) FieldType<Is>();
+            }
+        }
+    }(), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::ValueConstructFields(size_t first, size_t last, std::index_sequence<Is...>, const Ts&... values)
+{
+    ([&](FieldType<Is>* data, const FieldType<Is>& value)
+    {
+        for (size_t count = last - first; count != 0; count--, data++)
+        {
+            new (data) FieldType<Is>(value);
+        }
+    }(GetData<Is>() + first, values), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::CopyConstructFields(const SoAVector& other, std::index_sequence<Is...>)
+{
+    ([&](FieldType<Is>* dst, const FieldType<Is>* src)
+    {
+        if constexpr (TypeTraits::IsTriviallyCopyConstructible<FieldType<Is>>)
+        {
+            Memory::Memcpy(dst, src, sizeof(FieldType<Is>) * other.m_size);
+        }
+        else
+        {
+            for (size_t count = other.m_size; count != 0; count--, dst++, src++)
+            {
+                new (dst) FieldType<Is>(*src);
+            }
+        }
+    }(GetData<Is>(), other.template GetData<Is>()), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is, typename... Args>
+inline void SoAVector<Ts...>::ConstructFields(size_t index, std::index_sequence<Is...>, Args&&... values)
+{
+    (new (GetData<Is>() + index) FieldType<Is>(Forward<Args>(values)), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::InsertFields(size_t index, std::index_sequence<Is...>, const Ts&... values)
+{
+    (InsertValue(GetData<Is>(), m_size, index, values), ...);
+}
+
+template <typename... Ts>
+template <size_t... Is>
+inline void SoAVector<Ts...>::EraseFields(size_t first, size_t last, std::index_sequence<Is...>)
+{
+    (EraseRange(GetData<Is>(), m_size, first, last), ...);
+}
+
+template <typename... Ts>
+template <typename T>
+inline void SoAVector<Ts...>::DestroyRange(T* data, size_t count)
+{
+    if constexpr (!TypeTraits::IsTriviallyDestructible<T>)
+    {
+        for (; count != 0; count--, data++)
+        {
+            data->~T();
+        }
+    }
+}
+
+template <typename... Ts>
+template <typename T>
+inline void SoAVector<Ts...>::RelocateRange(T* dst, T* src, size_t count)
+{
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        Memory::Memcpy(dst, src, sizeof(T) * count);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            new (dst + i) T(Move(src[i]));
+        }
+
+        DestroyRange(src, count);
+    }
+}
+
+template <typename... Ts>
+template <typename T>
+inline void SoAVector<Ts...>::InsertValue(T* data, size_t size, size_t index, const T& value)
+{
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        // The vacated element is uninitialized after Memmove, so the value is constructed rather than assigned.
+        Memory::Memmove(data + index + 1, data + index, sizeof(T) * (size - index));
+        new (data + index) T(value);
+    }
+    else if (index == size)
+    {
+        new (data + size) T(value);
+    }
+    else
+    {
+        new (data + size) T(Move(data[size - 1]));
+
+        for (size_t i = size - 1; i > index; i--)
+        {
+            data[i] = Move(data[i - 1]);
+        }
+
+        data[index] = value;
+    }
+}
+
+template <typename... Ts>
+template <typename T>
+inline void SoAVector<Ts...>::EraseRange(T* data, size_t size, size_t first, size_t last)
+{
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        DestroyRange(data + first, last - first);
+        Memory::Memmove(data + first, data + last, sizeof(T) * (size - last));
+    }
+    else
+    {
+        for (size_t i = first, j = last; j < size; i++, j++)
+        {
+            data[i] = Move(data[j]);
+        }
+
+        DestroyRange(data + size - (last - first), last - first);
+    }
+}
+
+} // namespace kw
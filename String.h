@@ -2,6 +2,8 @@
 
 #include "Concepts.h"
 #include "MallocAllocator.h"
+#include "StringView.h"
+#include "Utility.h"
 
 namespace kw
 {
@@ -213,4 +215,97 @@ public:
 
 using String = BasicString<char>;
 
+// Hash of strings. Transparent, so hash containers of strings can be searched by string views without constructing
+// temporary strings. The hash of a string is equal to the hash of a string view with the same characters.
+template<class T, class Allocator>
+struct Hash<BasicString<T, Allocator>>
+{
+	using IsTransparent = void;
+
+	size_t operator()(const BasicString<T, Allocator>& Value) const;
+	size_t operator()(BasicStringView<T> Value) const;
+};
+
+// Comparators of strings. Transparent, so strings can be compared with string views without conversions.
+template<class T, class Allocator>
+struct EqualTo<BasicString<T, Allocator>>
+{
+	using IsTransparent = void;
+
+	bool operator()(const BasicString<T, Allocator>& Lhs, const BasicString<T, Allocator>& Rhs) const;
+	bool operator()(const BasicString<T, Allocator>& Lhs, BasicStringView<T> Rhs) const;
+	bool operator()(BasicStringView<T> Lhs, const BasicString<T, Allocator>& Rhs) const;
+};
+
+template<class T, class Allocator>
+struct LessThan<BasicString<T, Allocator>>
+{
+	using IsTransparent = void;
+
+	bool operator()(const BasicString<T, Allocator>& Lhs, const BasicString<T, Allocator>& Rhs) const;
+	bool operator()(const BasicString<T, Allocator>& Lhs, BasicStringView<T> Rhs) const;
+	bool operator()(BasicStringView<T> Lhs, const BasicString<T, Allocator>& Rhs) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace StringDetails
+{
+
+template<class T, class Allocator>
+BasicStringView<T> MakeView(const BasicString<T, Allocator>& Value)
+{
+	return BasicStringView<T>(Value.GetData(), Value.GetSize());
+}
+
+} // namespace StringDetails
+
+template<class T, class Allocator>
+size_t Hash<BasicString<T, Allocator>>::operator()(const BasicString<T, Allocator>& Value) const
+{
+	return Hash<BasicStringView<T>>()(StringDetails::MakeView(Value));
+}
+
+template<class T, class Allocator>
+size_t Hash<BasicString<T, Allocator>>::operator()(BasicStringView<T> Value) const
+{
+	return Hash<BasicStringView<T>>()(Value);
+}
+
+template<class T, class Allocator>
+bool EqualTo<BasicString<T, Allocator>>::operator()(const BasicString<T, Allocator>& Lhs, const BasicString<T, Allocator>& Rhs) const
+{
+	return EqualTo<BasicStringView<T>>()(StringDetails::MakeView(Lhs), StringDetails::MakeView(Rhs));
+}
+
+template<class T, class Allocator>
+bool EqualTo<BasicString<T, Allocator>>::operator()(const BasicString<T, Allocator>& Lhs, BasicStringView<T> Rhs) const
+{
+	return EqualTo<BasicStringView<T>>()(StringDetails::MakeView(Lhs), Rhs);
+}
+
+template<class T, class Allocator>
+bool EqualTo<BasicString<T, Allocator>>::operator()(BasicStringView<T> Lhs, const BasicString<T, Allocator>& Rhs) const
+{
+	return EqualTo<BasicStringView<T>>()(Lhs, StringDetails::MakeView(Rhs));
+}
+
+template<class T, class Allocator>
+bool LessThan<BasicString<T, Allocator>>::operator()(const BasicString<T, Allocator>& Lhs, const BasicString<T, Allocator>& Rhs) const
+{
+	return LessThan<BasicStringView<T>>()(StringDetails::MakeView(Lhs), StringDetails::MakeView(Rhs));
+}
+
+template<class T, class Allocator>
+bool LessThan<BasicString<T, Allocator>>::operator()(const BasicString<T, Allocator>& Lhs, BasicStringView<T> Rhs) const
+{
+	return LessThan<BasicStringView<T>>()(StringDetails::MakeView(Lhs), Rhs);
+}
+
+template<class T, class Allocator>
+bool LessThan<BasicString<T, Allocator>>::operator()(BasicStringView<T> Lhs, const BasicString<T, Allocator>& Rhs) const
+{
+	return LessThan<BasicStringView<T>>()(Lhs, StringDetails::MakeView(Rhs));
+}
+
 } // namespace kw
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "Algorithms.h"
 #include "Concepts.h"
 #include "Iterators.h"
+#include "Utility.h"
 
 namespace kw
 {
@@ -81,4 +83,50 @@ private:
 
 using StringView = BasicStringView<char>;
 
+// Hash of string views. Equal to the hash of strings with the same characters.
+template<class T>
+struct Hash<BasicStringView<T>>
+{
+	using IsTransparent = void;
+
+	size_t operator()(BasicStringView<T> Value) const;
+};
+
+// Comparators of string views. Characters are compared as integers.
+template<class T>
+struct EqualTo<BasicStringView<T>>
+{
+	using IsTransparent = void;
+
+	bool operator()(BasicStringView<T> Lhs, BasicStringView<T> Rhs) const;
+};
+
+template<class T>
+struct LessThan<BasicStringView<T>>
+{
+	using IsTransparent = void;
+
+	bool operator()(BasicStringView<T> Lhs, BasicStringView<T> Rhs) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T>
+size_t Hash<BasicStringView<T>>::operator()(BasicStringView<T> Value) const
+{
+	return HashBytes(Value.GetData(), sizeof(T) * Value.GetSize());
+}
+
+template<class T>
+bool EqualTo<BasicStringView<T>>::operator()(BasicStringView<T> Lhs, BasicStringView<T> Rhs) const
+{
+	return Lhs.GetSize() == Rhs.GetSize() && Algorithms::Equal(Lhs.GetData(), Rhs.GetData(), Lhs.GetSize());
+}
+
+template<class T>
+bool LessThan<BasicStringView<T>>::operator()(BasicStringView<T> Lhs, BasicStringView<T> Rhs) const
+{
+	return Algorithms::Compare(Lhs.GetData(), Lhs.GetSize(), Rhs.GetData(), Rhs.GetSize()) < 0;
+}
+
 } // namespace kw
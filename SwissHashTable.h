@@ -0,0 +1,1153 @@
+#pragma once
+
+#include "HashTraits.h"
+#include "Macros.h"
+#include "Memory.h"
+#include "Pair.h"
+#include "TypeTraits.h"
+#include "Utility.h"
+
+#include <bit>
+#include <cstdint>
+#include <new>
+
+#if defined(KW_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace kw
+{
+
+template<class Traits>
+class SwissHashTable;
+
+namespace HashDetails
+{
+
+// Control bytes of `SwissHashTable` loaded from an arbitrary position. Every match returns a bit mask where the i-th
+// bit corresponds to the i-th control byte.
+class SwissGroup
+{
+public:
+	// Number of control bytes compared at once.
+	static constexpr size_t Width = 16;
+
+	// Control bytes of occupied slots store a 7-bit hash fragment. Other control bytes are negative.
+	static constexpr int8_t Empty = -128;
+	static constexpr int8_t Deleted = -2;
+	static constexpr int8_t Sentinel = -1;
+
+	explicit SwissGroup(const int8_t* Control);
+
+	// Return occupied slots with the given hash fragment.
+	uint32_t Match(int8_t Fragment) const;
+
+	// Return empty slots.
+	uint32_t MatchEmpty() const;
+
+	// Return empty and deleted slots.
+	uint32_t MatchFree() const;
+
+	// Return occupied slots and sentinels.
+	uint32_t MatchOccupied() const;
+
+private:
+#if defined(KW_SIMD_SSE2)
+	__m128i mControl;
+#else
+	const int8_t* mControl;
+#endif
+};
+
+} // namespace HashDetails
+
+// Bidirectional iterator over elements of `SwissHashTable`. Free slots are skipped a group at a time.
+template<class T>
+class SwissHashIterator
+{
+public:
+	using ValueType = T;
+
+	SwissHashIterator() = default;
+	SwissHashIterator(const int8_t* InControl, T* InSlot);
+	SwissHashIterator(const SwissHashIterator<TypeTraits::RemoveConst<T>>& Other);
+
+	ValueType& operator*() const;
+	ValueType* operator->() const;
+
+	SwissHashIterator& operator++();
+	SwissHashIterator operator++(int);
+
+	SwissHashIterator& operator--();
+	SwissHashIterator operator--(int);
+
+	friend auto operator<=>(const SwissHashIterator& Lhs, const SwissHashIterator& Rhs) = default;
+
+private:
+	template<class U>
+	friend class SwissHashIterator;
+
+	template<class Traits>
+	friend class SwissHashTable;
+
+	const int8_t* mControl;
+	T* mSlot;
+};
+
+// Open addressing table with linear probing and a separate array of control bytes. Every occupied slot has a control
+// byte with 7 bits of its hash that are not used for the home slot. A lookup compares the control bytes of 16
+// consecutive slots at once with SSE2 and only compares keys of the slots with the matching fragment, which is
+// 1/128 of the slots with different keys. It stops at the first group with an empty slot, so lookups of missing keys
+// rarely touch elements at all. Erasure leaves a tombstone unless the following slot is empty. Tombstones are reused
+// by insertions and purged by rehashing. See `HashBase` for the interface.
+template<class Traits>
+class SwissHashTable : protected Traits::AllocatorType
+{
+public:
+	using KeyType = typename Traits::KeyType;
+	using ElementType = typename Traits::ElementType;
+	using AllocatorType = typename Traits::AllocatorType;
+
+	using Iterator = SwissHashIterator<ElementType>;
+	using ConstIterator = SwissHashIterator<const ElementType>;
+
+	explicit SwissHashTable(const AllocatorType& InAllocator);
+	SwissHashTable(const SwissHashTable& Other);
+	SwissHashTable(SwissHashTable&& Other);
+	~SwissHashTable();
+
+	template<class OtherTraits>
+	SwissHashTable(const SwissHashTable<OtherTraits>& Other, const AllocatorType& InAllocator);
+
+	SwissHashTable& operator=(const SwissHashTable& Other);
+	SwissHashTable& operator=(SwissHashTable&& Other);
+
+	void Reserve(size_t Capacity);
+	void Clear();
+
+	size_t GetSize() const;
+	size_t GetCapacity() const;
+	const AllocatorType& GetAllocator() const;
+
+	float GetLoadFactor() const;
+	float GetMaxLoadFactor() const;
+	void SetMaxLoadFactor(float LoadFactor);
+
+	// Reallocate the table with the least number of home slots that fits the given number of elements and all the
+	// current ones, which also purges tombstones. An empty table with zero capacity frees its memory.
+	void Rehash(size_t Capacity);
+
+	// Return the index of the first element with the given key or `GetEndIndex()` if it doesn't exist. The key is
+	// either `KeyType` or a `HashLookupKey`.
+	template<class K>
+	size_t FindIndex(const K& InKey, size_t Hash) const;
+
+	// Return the index past the last element of the run of equal keys that starts at the given index.
+	size_t FindRunEnd(size_t Index) const;
+
+	// For unique keys, return the index of an existing element with the given key and false, if there's one.
+	// Otherwise make room for a new element and return its index and true. The caller constructs the element.
+	Pair<size_t, bool> FindOrPrepareInsert(const KeyType& InKey, size_t Hash);
+
+	// Return whether an insertion of a new element may rehash the table.
+	bool IsFull() const;
+
+	// Start loading the memory of the home slot of the given hash.
+	void Prefetch(size_t Hash) const;
+
+	// Destroy the element at the given index. Return the index of the element that follows it in the iteration order.
+	size_t EraseIndex(size_t Index);
+
+	// Destroy the run of equal keys of the given length that starts at the given index. Keys aren't compared, so the
+	// elements of the run may be moved from already.
+	void EraseRun(size_t Index, size_t Count);
+
+	// Return the index of the first element starting from the given index, or `GetEndIndex()`.
+	size_t SkipEmpty(size_t Index) const;
+
+	size_t GetEndIndex() const;
+
+	ElementType& GetElement(size_t Index);
+	const ElementType& GetElement(size_t Index) const;
+
+	Iterator MakeIterator(size_t Index);
+	ConstIterator MakeIterator(size_t Index) const;
+	size_t GetIndex(ConstIterator Position) const;
+
+	// Iterators to the first element, past the last element, to the last element, and before the first element.
+	Iterator GetBegin();
+	ConstIterator GetBegin() const;
+	Iterator GetEnd();
+	ConstIterator GetEnd() const;
+	Iterator GetLast();
+	ConstIterator GetLast() const;
+	Iterator GetBeforeBegin();
+	ConstIterator GetBeforeBegin() const;
+
+private:
+	template<class OtherTraits>
+	friend class SwissHashTable;
+
+	using Group = HashDetails::SwissGroup;
+	using ControlAllocator = typename HashDetails::RebindAllocator<AllocatorType, int8_t>::Type;
+
+	// The number of elements and tombstones never exceeds the maximum load factor times the number of home slots.
+	// Group probing keeps lookups short at higher load than probing one slot at a time, but a lookup only stops at a
+	// group with an empty slot, so the load must leave a few of them.
+	static constexpr float DefaultMaxLoadFactor = 0.875f;
+	static constexpr float MinMaxLoadFactor = 0.125f;
+	static constexpr float MaxMaxLoadFactor = 0.9375f;
+
+	// Minimum number of home slots of a non-empty table.
+	static constexpr size_t MinCapacity = 16;
+
+	// Slots after the last home slot let the probe sequence run past the end without wrapping around, like in
+	// `RobinHoodHashTable`.
+	static constexpr size_t MaxOverflow = 64;
+
+	// Return how many elements and tombstones the given number of home slots can store.
+	size_t GetMaxSize(size_t Capacity) const;
+
+	// Return the least number of home slots that can store the given number of elements.
+	size_t GetMinCapacity(size_t Size) const;
+
+	// Return the home slot of the given hash.
+	size_t GetHomeIndex(size_t Hash) const;
+
+	// Return the control byte of the given hash. These are the bits right below the ones of the home slot, so
+	// elements with the same home slot rarely have the same fragment.
+	int8_t GetFragment(size_t Hash) const;
+
+	// Return the first free slot starting from the given index, or `mSlotCount` if there's none.
+	size_t FindFree(size_t Index) const;
+
+	// Move the elements in [Index, FreeIndex) one slot forward. The slot at `FreeIndex` must be free.
+	void ShiftForward(size_t Index, size_t FreeIndex);
+
+	// Move all elements to a table with the given number of home slots.
+	void RehashSlots(size_t Capacity);
+
+	// Reallocate the table with a larger overflow area. Elements keep their indices.
+	void ExtendOverflow();
+
+	// Copy the elements from the given table into this empty table.
+	template<class OtherTable>
+	void CopySlots(const OtherTable& Other);
+
+	void DestroyElements();
+
+	void AllocateSlots(size_t SlotCount);
+	void DeallocateSlots(int8_t* Control, ElementType* Slots);
+
+	// Control bytes of `mSlotCount` slots, preceded by one sentinel and followed by a group of sentinels, so groups
+	// can be loaded from any slot.
+	int8_t* mControl;
+	ElementType* mSlots;
+
+	size_t mSize;
+	size_t mDeleted;
+
+	// Number of home slots. Either zero or a power of two.
+	size_t mCapacity;
+
+	// Number of home slots plus the overflow area.
+	size_t mSlotCount;
+
+	// Number of elements and tombstones that fit into the home slots at the maximum load factor.
+	size_t mMaxSize;
+
+	float mMaxLoadFactor;
+};
+
+// Layout of hash containers that uses `SwissHashTable`. Lookups of missing keys are much faster than with
+// `RobinHoodHashLayout`, but lookups of existing keys in large tables touch two cache lines instead of one. Good for
+// miss-heavy workloads like filtering and deduplication.
+struct SwissHashLayout
+{
+	template<class Traits>
+	using Table = SwissHashTable<Traits>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(KW_SIMD_SSE2)
+
+inline HashDetails::SwissGroup::SwissGroup(const int8_t* Control)
+	: mControl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Control)))
+{
+}
+
+inline uint32_t HashDetails::SwissGroup::Match(int8_t Fragment) const
+{
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Fragment), mControl)));
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchEmpty() const
+{
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Empty), mControl)));
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchFree() const
+{
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), mControl)));
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchOccupied() const
+{
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(mControl, _mm_set1_epi8(Deleted))));
+}
+
+#else
+
+inline HashDetails::SwissGroup::SwissGroup(const int8_t* Control)
+	: mControl(Control)
+{
+}
+
+inline uint32_t HashDetails::SwissGroup::Match(int8_t Fragment) const
+{
+	uint32_t Mask = 0;
+	for (size_t i = 0; i < Width; i++)
+	{
+		Mask |= static_cast<uint32_t>(mControl[i] == Fragment) << i;
+	}
+	return Mask;
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchEmpty() const
+{
+	return Match(Empty);
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchFree() const
+{
+	uint32_t Mask = 0;
+	for (size_t i = 0; i < Width; i++)
+	{
+		Mask |= static_cast<uint32_t>(mControl[i] < Sentinel) << i;
+	}
+	return Mask;
+}
+
+inline uint32_t HashDetails::SwissGroup::MatchOccupied() const
+{
+	uint32_t Mask = 0;
+	for (size_t i = 0; i < Width; i++)
+	{
+		Mask |= static_cast<uint32_t>(mControl[i] > Deleted) << i;
+	}
+	return Mask;
+}
+
+#endif // defined(KW_SIMD_SSE2)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class T>
+SwissHashIterator<T>::SwissHashIterator(const int8_t* InControl, T* InSlot)
+	: mControl(InControl)
+	, mSlot(InSlot)
+{
+}
+
+template<class T>
+SwissHashIterator<T>::SwissHashIterator(const SwissHashIterator<TypeTraits::RemoveConst<T>>& Other)
+	: mControl(Other.mControl)
+	, mSlot(Other.mSlot)
+{
+}
+
+template<class T>
+typename SwissHashIterator<T>::ValueType& SwissHashIterator<T>::operator*() const
+{
+	return *mSlot;
+}
+
+template<class T>
+typename SwissHashIterator<T>::ValueType* SwissHashIterator<T>::operator->() const
+{
+	return mSlot;
+}
+
+template<class T>
+SwissHashIterator<T>& SwissHashIterator<T>::operator++()
+{
+	// The group of sentinels after the last slot stops the loop, so there's no need for bound checks.
+	size_t Offset = 1;
+	while (true)
+	{
+		uint32_t Mask = HashDetails::SwissGroup(mControl + Offset).MatchOccupied();
+		if (Mask != 0)
+		{
+			Offset += std::countr_zero(Mask);
+			break;
+		}
+		Offset += HashDetails::SwissGroup::Width;
+	}
+
+	mControl += Offset;
+	mSlot += Offset;
+
+	return *this;
+}
+
+template<class T>
+SwissHashIterator<T> SwissHashIterator<T>::operator++(int)
+{
+	SwissHashIterator Result(*this);
+	++*this;
+	return Result;
+}
+
+template<class T>
+SwissHashIterator<T>& SwissHashIterator<T>::operator--()
+{
+	// The sentinel before the first slot stops the loop.
+	do
+	{
+		--mControl;
+		--mSlot;
+	}
+	while (*mControl < HashDetails::SwissGroup::Sentinel);
+
+	return *this;
+}
+
+template<class T>
+SwissHashIterator<T> SwissHashIterator<T>::operator--(int)
+{
+	SwissHashIterator Result(*this);
+	--*this;
+	return Result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Traits>
+SwissHashTable<Traits>::SwissHashTable(const AllocatorType& InAllocator)
+	: AllocatorType(InAllocator)
+	, mControl(nullptr)
+	, mSlots(nullptr)
+	, mSize(0)
+	, mDeleted(0)
+	, mCapacity(0)
+	, mSlotCount(0)
+	, mMaxSize(0)
+	, mMaxLoadFactor(DefaultMaxLoadFactor)
+{
+}
+
+template<class Traits>
+SwissHashTable<Traits>::SwissHashTable(const SwissHashTable& Other)
+	: SwissHashTable(Other.GetAllocator())
+{
+	CopySlots(Other);
+}
+
+template<class Traits>
+template<class OtherTraits>
+SwissHashTable<Traits>::SwissHashTable(const SwissHashTable<OtherTraits>& Other, const AllocatorType& InAllocator)
+	: SwissHashTable(InAllocator)
+{
+	CopySlots(Other);
+}
+
+template<class Traits>
+SwissHashTable<Traits>::SwissHashTable(SwissHashTable&& Other)
+	: AllocatorType(static_cast<AllocatorType&&>(Other))
+	, mControl(Other.mControl)
+	, mSlots(Other.mSlots)
+	, mSize(Other.mSize)
+	, mDeleted(Other.mDeleted)
+	, mCapacity(Other.mCapacity)
+	, mSlotCount(Other.mSlotCount)
+	, mMaxSize(Other.mMaxSize)
+	, mMaxLoadFactor(Other.mMaxLoadFactor)
+{
+	Other.mControl = nullptr;
+	Other.mSlots = nullptr;
+	Other.mSize = 0;
+	Other.mDeleted = 0;
+	Other.mCapacity = 0;
+	Other.mSlotCount = 0;
+	Other.mMaxSize = 0;
+}
+
+template<class Traits>
+SwissHashTable<Traits>::~SwissHashTable()
+{
+	DestroyElements();
+	DeallocateSlots(mControl, mSlots);
+}
+
+template<class Traits>
+SwissHashTable<Traits>& SwissHashTable<Traits>::operator=(const SwissHashTable& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateSlots(mControl, mSlots);
+
+		mControl = nullptr;
+		mSlots = nullptr;
+		mSize = 0;
+		mDeleted = 0;
+		mCapacity = 0;
+		mSlotCount = 0;
+		mMaxSize = 0;
+
+		CopySlots(Other);
+	}
+	return *this;
+}
+
+template<class Traits>
+SwissHashTable<Traits>& SwissHashTable<Traits>::operator=(SwissHashTable&& Other)
+{
+	if (this != &Other)
+	{
+		DestroyElements();
+		DeallocateSlots(mControl, mSlots);
+
+		static_cast<AllocatorType&>(*this) = static_cast<AllocatorType&&>(Other);
+
+		mControl = Other.mControl;
+		mSlots = Other.mSlots;
+		mSize = Other.mSize;
+		mDeleted = Other.mDeleted;
+		mCapacity = Other.mCapacity;
+		mSlotCount = Other.mSlotCount;
+		mMaxSize = Other.mMaxSize;
+		mMaxLoadFactor = Other.mMaxLoadFactor;
+
+		Other.mControl = nullptr;
+		Other.mSlots = nullptr;
+		Other.mSize = 0;
+		Other.mDeleted = 0;
+		Other.mCapacity = 0;
+		Other.mSlotCount = 0;
+		Other.mMaxSize = 0;
+	}
+	return *this;
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::Reserve(size_t Capacity)
+{
+	size_t NewCapacity = GetMinCapacity(Capacity);
+	if (NewCapacity > mCapacity)
+	{
+		RehashSlots(NewCapacity);
+	}
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::Clear()
+{
+	DestroyElements();
+
+	if (mControl != nullptr)
+	{
+		Memory::Memset(mControl, Group::Empty, mSlotCount);
+	}
+
+	mSize = 0;
+	mDeleted = 0;
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetSize() const
+{
+	return mSize;
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetCapacity() const
+{
+	return mMaxSize;
+}
+
+template<class Traits>
+const typename SwissHashTable<Traits>::AllocatorType& SwissHashTable<Traits>::GetAllocator() const
+{
+	return *this;
+}
+
+template<class Traits>
+float SwissHashTable<Traits>::GetLoadFactor() const
+{
+	return mCapacity != 0 ? static_cast<float>(mSize) / static_cast<float>(mCapacity) : 0.f;
+}
+
+template<class Traits>
+float SwissHashTable<Traits>::GetMaxLoadFactor() const
+{
+	return mMaxLoadFactor;
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::SetMaxLoadFactor(float LoadFactor)
+{
+	mMaxLoadFactor = LoadFactor < MinMaxLoadFactor ? MinMaxLoadFactor : LoadFactor > MaxMaxLoadFactor ? MaxMaxLoadFactor : LoadFactor;
+	mMaxSize = GetMaxSize(mCapacity);
+
+	if (mSize + mDeleted > mMaxSize)
+	{
+		RehashSlots(GetMinCapacity(mSize));
+	}
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::Rehash(size_t Capacity)
+{
+	if (Capacity < mSize)
+	{
+		Capacity = mSize;
+	}
+
+	if (Capacity == 0)
+	{
+		DeallocateSlots(mControl, mSlots);
+
+		mControl = nullptr;
+		mSlots = nullptr;
+		mDeleted = 0;
+		mCapacity = 0;
+		mSlotCount = 0;
+		mMaxSize = 0;
+	}
+	else
+	{
+		size_t NewCapacity = GetMinCapacity(Capacity);
+		if (NewCapacity != mCapacity || mDeleted != 0)
+		{
+			RehashSlots(NewCapacity);
+		}
+	}
+}
+
+template<class Traits>
+template<class K>
+size_t SwissHashTable<Traits>::FindIndex(const K& InKey, size_t Hash) const
+{
+	if (mSize == 0)
+	{
+		return mSlotCount;
+	}
+
+	size_t Index = GetHomeIndex(Hash);
+	int8_t Fragment = GetFragment(Hash);
+
+	while (true)
+	{
+		Group Control(mControl + Index);
+
+		// Equal keys are contiguous, so the first match is the first element of the run.
+		for (uint32_t Mask = Control.Match(Fragment); Mask != 0; Mask &= Mask - 1)
+		{
+			size_t Candidate = Index + std::countr_zero(Mask);
+			if (Traits::IsEqual(Traits::GetKey(mSlots[Candidate]), InKey))
+			{
+				return Candidate;
+			}
+		}
+
+		// Insertion takes the first free slot after the home slot, and a slot only becomes empty when nothing is
+		// probed past it. So an empty slot ends the probe sequence.
+		if (Control.MatchEmpty() != 0)
+		{
+			return mSlotCount;
+		}
+
+		Index += Group::Width;
+		if (Index >= mSlotCount)
+		{
+			return mSlotCount;
+		}
+	}
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::FindRunEnd(size_t Index) const
+{
+	const KeyType& RunKey = Traits::GetKey(mSlots[Index]);
+
+	// Equal keys have equal fragments. Sentinels after the last slot don't match any fragment.
+	size_t Last = Index + 1;
+	while (mControl[Last] == mControl[Index] && Traits::IsEqual(Traits::GetKey(mSlots[Last]), RunKey))
+	{
+		Last++;
+	}
+
+	return Last;
+}
+
+template<class Traits>
+Pair<size_t, bool> SwissHashTable<Traits>::FindOrPrepareInsert(const KeyType& InKey, size_t Hash)
+{
+	if (mCapacity == 0)
+	{
+		RehashSlots(MinCapacity);
+	}
+
+	while (true)
+	{
+		size_t Index = FindIndex(InKey, Hash);
+		if (Index != mSlotCount)
+		{
+			if constexpr (Traits::IsUnique)
+			{
+				return { Index, false };
+			}
+			else
+			{
+				// Insert after the equal keys to keep them contiguous.
+				Index = FindRunEnd(Index);
+			}
+		}
+		else
+		{
+			Index = FindFree(GetHomeIndex(Hash));
+		}
+
+		size_t FreeIndex = FindFree(Index);
+		if (FreeIndex == mSlotCount)
+		{
+			ExtendOverflow();
+			continue;
+		}
+
+		if (mControl[FreeIndex] == Group::Empty)
+		{
+			if (mSize + mDeleted >= mMaxSize)
+			{
+				// If most of the load is tombstones, purge them without growing.
+				RehashSlots((mSize + 1) * 2 <= mMaxSize ? mCapacity : mCapacity * 2);
+				continue;
+			}
+		}
+		else
+		{
+			mDeleted--;
+		}
+
+		if constexpr (!Traits::IsUnique)
+		{
+			ShiftForward(Index, FreeIndex);
+		}
+
+		mControl[Index] = GetFragment(Hash);
+		mSize++;
+
+		return { Index, true };
+	}
+}
+
+template<class Traits>
+bool SwissHashTable<Traits>::IsFull() const
+{
+	return mCapacity != 0 && mSize + mDeleted >= mMaxSize;
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::Prefetch(size_t Hash) const
+{
+	// Most lookups of existing keys read the first slot of the group too, so start loading both.
+	if (mCapacity != 0)
+	{
+		size_t Index = GetHomeIndex(Hash);
+		KW_PREFETCH(mControl + Index);
+		KW_PREFETCH(mSlots + Index);
+	}
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::EraseIndex(size_t Index)
+{
+	size_t Last = Index;
+	if constexpr (!Traits::IsUnique)
+	{
+		Last = FindRunEnd(Index) - 1;
+	}
+
+	mSlots[Index].~ElementType();
+
+	// Keep equal keys contiguous by moving the last one of the run into the erased slot.
+	if (Last != Index)
+	{
+		new (&mSlots[Index]) ElementType(Move(mSlots[Last]));
+		mSlots[Last].~ElementType();
+	}
+
+	if (Last + 1 == mSlotCount || mControl[Last + 1] == Group::Empty)
+	{
+		mControl[Last] = Group::Empty;
+	}
+	else
+	{
+		mControl[Last] = Group::Deleted;
+		mDeleted++;
+	}
+
+	mSize--;
+
+	return SkipEmpty(Index);
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::EraseRun(size_t Index, size_t Count)
+{
+	// Nothing moves. Going from the end of the run, a slot becomes empty if the next one is, like in `EraseIndex`.
+	for (size_t i = Index + Count; i-- > Index;)
+	{
+		mSlots[i].~ElementType();
+
+		if (i + 1 == mSlotCount || mControl[i + 1] == Group::Empty)
+		{
+			mControl[i] = Group::Empty;
+		}
+		else
+		{
+			mControl[i] = Group::Deleted;
+			mDeleted++;
+		}
+	}
+
+	mSize -= Count;
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::SkipEmpty(size_t Index) const
+{
+	// The group of sentinels after the last slot stops the loop.
+	while (true)
+	{
+		uint32_t Mask = Group(mControl + Index).MatchOccupied();
+		if (Mask != 0)
+		{
+			return Index + std::countr_zero(Mask);
+		}
+		Index += Group::Width;
+	}
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetEndIndex() const
+{
+	return mSlotCount;
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ElementType& SwissHashTable<Traits>::GetElement(size_t Index)
+{
+	return mSlots[Index];
+}
+
+template<class Traits>
+const typename SwissHashTable<Traits>::ElementType& SwissHashTable<Traits>::GetElement(size_t Index) const
+{
+	return mSlots[Index];
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::Iterator SwissHashTable<Traits>::MakeIterator(size_t Index)
+{
+	return Iterator(mControl + Index, mSlots + Index);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ConstIterator SwissHashTable<Traits>::MakeIterator(size_t Index) const
+{
+	return ConstIterator(mControl + Index, mSlots + Index);
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetIndex(ConstIterator Position) const
+{
+	return Position.mControl - mControl;
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::Iterator SwissHashTable<Traits>::GetBegin()
+{
+	return mControl != nullptr ? MakeIterator(SkipEmpty(0)) : Iterator(nullptr, nullptr);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ConstIterator SwissHashTable<Traits>::GetBegin() const
+{
+	return mControl != nullptr ? MakeIterator(SkipEmpty(0)) : ConstIterator(nullptr, nullptr);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::Iterator SwissHashTable<Traits>::GetEnd()
+{
+	return MakeIterator(mSlotCount);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ConstIterator SwissHashTable<Traits>::GetEnd() const
+{
+	return MakeIterator(mSlotCount);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::Iterator SwissHashTable<Traits>::GetLast()
+{
+	// The sentinel before the first slot stops the decrement of an empty table's end iterator.
+	return mControl != nullptr ? --GetEnd() : Iterator(nullptr, nullptr);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ConstIterator SwissHashTable<Traits>::GetLast() const
+{
+	return mControl != nullptr ? --GetEnd() : ConstIterator(nullptr, nullptr);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::Iterator SwissHashTable<Traits>::GetBeforeBegin()
+{
+	return mControl != nullptr ? Iterator(mControl - 1, mSlots - 1) : Iterator(nullptr, nullptr);
+}
+
+template<class Traits>
+typename SwissHashTable<Traits>::ConstIterator SwissHashTable<Traits>::GetBeforeBegin() const
+{
+	return mControl != nullptr ? ConstIterator(mControl - 1, mSlots - 1) : ConstIterator(nullptr, nullptr);
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetMaxSize(size_t Capacity) const
+{
+	return static_cast<size_t>(static_cast<double>(Capacity) * mMaxLoadFactor);
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetMinCapacity(size_t Size) const
+{
+	size_t Capacity = MinCapacity;
+	while (GetMaxSize(Capacity) < Size)
+	{
+		Capacity *= 2;
+	}
+
+	return Capacity;
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::GetHomeIndex(size_t Hash) const
+{
+	// Fibonacci hashing, see `RobinHoodHashTable`.
+	return static_cast<size_t>((static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(mCapacity)));
+}
+
+template<class Traits>
+int8_t SwissHashTable<Traits>::GetFragment(size_t Hash) const
+{
+	return static_cast<int8_t>(((static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ULL) >> (57 - std::countr_zero(mCapacity))) & 0x7F);
+}
+
+template<class Traits>
+size_t SwissHashTable<Traits>::FindFree(size_t Index) const
+{
+	// Sentinels after the last slot are not free, so the result never exceeds `mSlotCount`.
+	while (Index < mSlotCount)
+	{
+		uint32_t Mask = Group(mControl + Index).MatchFree();
+		if (Mask != 0)
+		{
+			return Index + std::countr_zero(Mask);
+		}
+		Index += Group::Width;
+	}
+
+	return mSlotCount;
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::ShiftForward(size_t Index, size_t FreeIndex)
+{
+	// All slots in [Index, FreeIndex) are occupied. Every element moves away from its home slot, so lookups still
+	// find it.
+	Memory::Memmove(mControl + Index + 1, mControl + Index, FreeIndex - Index);
+
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memmove(mSlots + Index + 1, mSlots + Index, sizeof(ElementType) * (FreeIndex - Index));
+	}
+	else
+	{
+		for (size_t i = FreeIndex; i > Index; i--)
+		{
+			new (&mSlots[i]) ElementType(Move(mSlots[i - 1]));
+			mSlots[i - 1].~ElementType();
+		}
+	}
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::RehashSlots(size_t Capacity)
+{
+	int8_t* OldControl = mControl;
+	ElementType* OldSlots = mSlots;
+	size_t OldSlotCount = mSlotCount;
+
+	mCapacity = Capacity;
+	AllocateSlots(Capacity + (Capacity < MaxOverflow ? Capacity : MaxOverflow));
+	mDeleted = 0;
+	mMaxSize = GetMaxSize(Capacity);
+
+	// Index of the previously inserted element.
+	size_t Previous = mSlotCount;
+
+	for (size_t i = 0; i < OldSlotCount; i++)
+	{
+		if (OldControl[i] >= 0)
+		{
+			size_t Hash = Traits::GetHash(Traits::GetKey(OldSlots[i]));
+			int8_t Fragment = GetFragment(Hash);
+
+			// Equal keys are contiguous in the old table, so the run of an equal key is the one inserted last.
+			size_t Index = GetHomeIndex(Hash);
+			bool IsSameRun = false;
+			if constexpr (!Traits::IsUnique)
+			{
+				if (Previous != mSlotCount && mControl[Previous] == Fragment && Traits::IsEqual(Traits::GetKey(mSlots[Previous]), Traits::GetKey(OldSlots[i])))
+				{
+					Index = Previous + 1;
+					IsSameRun = true;
+				}
+			}
+
+			size_t FreeIndex = FindFree(Index);
+			if (FreeIndex == mSlotCount)
+			{
+				ExtendOverflow();
+			}
+
+			if (IsSameRun)
+			{
+				ShiftForward(Index, FreeIndex);
+			}
+			else
+			{
+				Index = FreeIndex;
+			}
+
+			new (&mSlots[Index]) ElementType(Move(OldSlots[i]));
+			OldSlots[i].~ElementType();
+
+			mControl[Index] = Fragment;
+			Previous = Index;
+		}
+	}
+
+	DeallocateSlots(OldControl, OldSlots);
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::ExtendOverflow()
+{
+	int8_t* OldControl = mControl;
+	ElementType* OldSlots = mSlots;
+	size_t OldSlotCount = mSlotCount;
+
+	// Only happens with long runs near the end of the table, e.g. when many keys have the same hash.
+	AllocateSlots(mSlotCount + mSlotCount - mCapacity);
+
+	Memory::Memcpy(mControl, OldControl, OldSlotCount);
+
+	if constexpr (TypeTraits::IsTriviallyRelocatable<ElementType>)
+	{
+		Memory::Memcpy(mSlots, OldSlots, sizeof(ElementType) * OldSlotCount);
+	}
+	else
+	{
+		for (size_t i = 0; i < OldSlotCount; i++)
+		{
+			if (OldControl[i] >= 0)
+			{
+				new (&mSlots[i]) ElementType(Move(OldSlots[i]));
+				OldSlots[i].~ElementType();
+			}
+		}
+	}
+
+	DeallocateSlots(OldControl, OldSlots);
+}
+
+template<class Traits>
+template<class OtherTable>
+void SwissHashTable<Traits>::CopySlots(const OtherTable& Other)
+{
+	mMaxLoadFactor = Other.mMaxLoadFactor;
+
+	if (Other.mSize > 0)
+	{
+		// Same hash and the same number of home slots give the same layout, so no rehashing is needed.
+		mCapacity = Other.mCapacity;
+		mMaxSize = Other.mMaxSize;
+		AllocateSlots(Other.mSlotCount);
+
+		Memory::Memcpy(mControl, Other.mControl, mSlotCount);
+
+		if constexpr (TypeTraits::IsTriviallyCopyable<ElementType>)
+		{
+			Memory::Memcpy(mSlots, Other.mSlots, sizeof(ElementType) * mSlotCount);
+		}
+		else
+		{
+			for (size_t i = 0; i < mSlotCount; i++)
+			{
+				if (mControl[i] >= 0)
+				{
+					new (&mSlots[i]) ElementType(Other.mSlots[i]);
+				}
+			}
+		}
+
+		mSize = Other.mSize;
+		mDeleted = Other.mDeleted;
+	}
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::DestroyElements()
+{
+	if constexpr (!TypeTraits::IsTriviallyDestructible<ElementType>)
+	{
+		for (size_t i = 0; i < mSlotCount; i++)
+		{
+			if (mControl[i] >= 0)
+			{
+				mSlots[i].~ElementType();
+			}
+		}
+	}
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::AllocateSlots(size_t SlotCount)
+{
+	mControl = ControlAllocator(GetAllocator()).Allocate(SlotCount + Group::Width + 1) + 1;
+
+	mControl[-1] = Group::Sentinel;
+	Memory::Memset(mControl, Group::Empty, SlotCount);
+	Memory::Memset(mControl + SlotCount, Group::Sentinel, Group::Width);
+
+	// One more slot before the first one keeps the pointer of the iterator before the beginning valid.
+	mSlots = static_cast<AllocatorType&>(*this).Allocate(SlotCount + 1) + 1;
+	mSlotCount = SlotCount;
+}
+
+template<class Traits>
+void SwissHashTable<Traits>::DeallocateSlots(int8_t* Control, ElementType* Slots)
+{
+	if (Control != nullptr)
+	{
+		ControlAllocator(GetAllocator()).Deallocate(Control - 1);
+		static_cast<AllocatorType&>(*this).Deallocate(Slots - 1);
+	}
+}
+
+} // namespace kw
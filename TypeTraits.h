@@ -310,6 +310,27 @@ static constexpr bool IsMoveAssignable = std::is_move_assignable_v<T>;
 template<class T>
 static constexpr bool IsTriviallyMoveAssignable = std::is_trivially_move_assignable_v<T>;
 
+// Whether an object of the given type can be moved to another address with a plain memory copy, i.e. move constructing
+// it at the new address and destroying the old one is equivalent to Memcpy. Specialize this for user types that only
+// own their resources through pointers (no self-references, no back pointers), e.g.:
+//
+//     template<>
+//     struct kw::TypeTraits::TriviallyRelocatable<MyType> : kw::TrueType {};
+template<class T>
+struct TriviallyRelocatable : BoolConstant<std::is_trivially_move_constructible_v<T> && std::is_trivially_destructible_v<T>> {};
+
+// Whether the given type is trivially relocatable. See `TriviallyRelocatable`.
+template<class T>
+static constexpr bool IsTriviallyRelocatable = TriviallyRelocatable<RemoveCV<T>>::value;
+
+// Whether objects of the given type can begin their lifetime without running any constructor, e.g. when the memory they
+// occupy is filled with Memcpy or by reading from a file. Approximation of C++23 `std::is_implicit_lifetime`: scalars,
+// arrays, and trivially destructible classes that are aggregates or have a trivial constructor.
+template<class T>
+static constexpr bool IsImplicitLifetime = std::is_scalar_v<T> || std::is_array_v<T> ||
+    (std::is_trivially_destructible_v<T> && (std::is_aggregate_v<T> || std::is_trivially_default_constructible_v<T> ||
+                                             std::is_trivially_copy_constructible_v<T> || std::is_trivially_move_constructible_v<T>));
+
 // TODO: Description.
 template<class T>
 static constexpr bool HasVirtualDestructor = std::has_virtual_destructor_v<T>;
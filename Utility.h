@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Concepts.h"
 #include "TypeTraits.h"
 
+#include <cstdint>
+
 namespace kw
 {
 
@@ -24,6 +27,43 @@ struct Hash
 	// Note that by default types don't have any hash functions defined.
 };
 
+// Hash of integers mixes the value with a single 128-bit multiplication. An identity hash lets keys crafted against
+// the multiplier of Fibonacci hashing, or keys that differ in a few bits only, pile up in a few slots of hash
+// containers. The high bits of the value don't reach the low bits of the hash, but hash containers multiply the hash
+// once more and only use its top bits, which depend on every bit of the value. Users that take the low bits of the hash
+// should mix it further first, e.g. with `HashCombine`.
+template<Integral T>
+struct Hash<T>
+{
+	size_t operator()(T Value) const;
+};
+
+// Hash of pointers is the hash of their addresses.
+template<class T>
+struct Hash<T*>
+{
+	size_t operator()(T* Value) const;
+};
+
+// Return a hash of the given bytes. Hashes of strings and string views are computed with it, so equal character
+// sequences have equal hashes regardless of the type that holds them. Reads 8 bytes at a time and mixes 48 bytes per
+// iteration in three independent lanes, so long keys are hashed at several bytes per cycle.
+size_t HashBytes(const void* Data, size_t Size);
+
+// Return a hash of two hashes that depends on their order. Useful to hash types with several members, e.g. `Pair`.
+size_t HashCombine(size_t Lhs, size_t Rhs);
+
+namespace HashDetails
+{
+
+// Return the high half of the 128-bit product of the given numbers.
+uint64_t MultiplyHigh(uint64_t Lhs, uint64_t Rhs);
+
+// Return the xor of both halves of the 128-bit product of the given numbers, the mixing step of the hashes above.
+uint64_t MultiplyMix(uint64_t Lhs, uint64_t Rhs);
+
+} // namespace HashDetails
+
 // TODO: Description.
 template<class T>
 struct EqualTo
@@ -2,6 +2,13 @@
 
 #include "Utility.h"
 
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace kw
 {
 
@@ -23,4 +30,146 @@ inline T&& Forward(std::remove_reference_t<T>&& value)
     return static_cast<T&&>(value);
 }
 
+namespace HashDetails
+{
+
+// Constants of the hashes below. Odd, with about half of the bits set in every byte.
+constexpr uint64_t HashSecret0 = 0x2D358DCCAA6C78A5ULL;
+constexpr uint64_t HashSecret1 = 0x8BB84B93962EACC9ULL;
+constexpr uint64_t HashSecret2 = 0x4B33A62ED433D4A3ULL;
+constexpr uint64_t HashSecret3 = 0x4D5A2DA51DE1AA47ULL;
+
+inline uint64_t Read64(const unsigned char* data)
+{
+    uint64_t result;
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+inline uint64_t Read32(const unsigned char* data)
+{
+    uint32_t result;
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+} // namespace HashDetails
+
+inline uint64_t HashDetails::MultiplyHigh(uint64_t lhs, uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>((static_cast<unsigned __int128>(lhs) * rhs) >> 64);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    return __umulh(lhs, rhs);
+#else
+    uint64_t lhsLow = lhs & 0xFFFFFFFF;
+    uint64_t lhsHigh = lhs >> 32;
+    uint64_t rhsLow = rhs & 0xFFFFFFFF;
+    uint64_t rhsHigh = rhs >> 32;
+
+    uint64_t middle = (lhsLow * rhsLow >> 32) + (lhsHigh * rhsLow & 0xFFFFFFFF) + lhsLow * rhsHigh;
+    return lhsHigh * rhsHigh + (lhsHigh * rhsLow >> 32) + (middle >> 32);
+#endif
+}
+
+inline uint64_t HashDetails::MultiplyMix(uint64_t lhs, uint64_t rhs)
+{
+    return (lhs * rhs) ^ MultiplyHigh(lhs, rhs);
+}
+
+template <Integral T>
+inline size_t Hash<T>::operator()(T value) const
+{
+    return static_cast<size_t>(HashDetails::MultiplyMix(static_cast<uint64_t>(value) ^ HashDetails::HashSecret0, HashDetails::HashSecret1));
+}
+
+template <class T>
+inline size_t Hash<T*>::operator()(T* value) const
+{
+    return Hash<uintptr_t>()(reinterpret_cast<uintptr_t>(value));
+}
+
+inline size_t HashBytes(const void* data, size_t size)
+{
+    // wyhash. Keys up to 16 bytes are read with two overlapping pairs of loads without any loop.
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    uint64_t seed = HashDetails::MultiplyMix(HashDetails::HashSecret0, HashDetails::HashSecret1);
+    uint64_t lhs;
+    uint64_t rhs;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            size_t offset = (size >> 3) << 2;
+            lhs = (HashDetails::Read32(bytes) << 32) | HashDetails::Read32(bytes + offset);
+            rhs = (HashDetails::Read32(bytes + size - 4) << 32) | HashDetails::Read32(bytes + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            lhs = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[size >> 1]) << 8) | bytes[size - 1];
+            rhs = 0;
+        }
+        else
+        {
+            lhs = 0;
+            rhs = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = size;
+        if (remaining > 48)
+        {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do
+            {
+                seed = HashDetails::MultiplyMix(HashDetails::Read64(bytes) ^ HashDetails::HashSecret1, HashDetails::Read64(bytes + 8) ^ seed);
+                seed1 = HashDetails::MultiplyMix(HashDetails::Read64(bytes + 16) ^ HashDetails::HashSecret2, HashDetails::Read64(bytes + 24) ^ seed1);
+                seed2 = HashDetails::MultiplyMix(HashDetails::Read64(bytes + 32) ^ HashDetails::HashSecret3, HashDetails::Read64(bytes + 40) ^ seed2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = HashDetails::MultiplyMix(HashDetails::Read64(bytes) ^ HashDetails::HashSecret1, HashDetails::Read64(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, which may overlap the ones mixed above.
+        lhs = HashDetails::Read64(bytes + remaining - 16);
+        rhs = HashDetails::Read64(bytes + remaining - 8);
+    }
+
+    lhs ^= HashDetails::HashSecret1;
+    rhs ^= seed;
+
+    uint64_t low = lhs * rhs;
+    uint64_t high = HashDetails::MultiplyHigh(lhs, rhs);
+    return static_cast<size_t>(HashDetails::MultiplyMix(low ^ HashDetails::HashSecret0 ^ size, high ^ HashDetails::HashSecret1));
+}
+
+inline size_t HashCombine(size_t lhs, size_t rhs)
+{
+    return static_cast<size_t>(HashDetails::MultiplyMix(static_cast<uint64_t>(lhs) ^ HashDetails::HashSecret2, static_cast<uint64_t>(rhs) ^ HashDetails::HashSecret3));
+}
+
+template <class T>
+inline bool EqualTo<T>::operator()(const T& lhs, const T& rhs) const
+{
+    return lhs == rhs;
+}
+
+template <class T>
+inline bool LessThan<T>::operator()(const T& lhs, const T& rhs) const
+{
+    return lhs < rhs;
+}
+
 } //namespace kw
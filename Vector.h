@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Algorithms.h"
 #include "Concepts.h"
+#include "GrowthPolicy.h"
 #include "Iterators.h"
 #include "MallocAllocator.h"
 #include "Utility.h"
@@ -10,13 +12,15 @@
 namespace kw
 {
 
-// TODO: Description.
-template <class T, class Allocator = MallocAllocator<T>>
+// A dynamic contiguous array. `GrowthPolicy` decides the new capacity when the container runs out of space,
+// see GrowthPolicy.h.
+template <class T, class Allocator = MallocAllocator<T>, class GrowthPolicy = DoublingGrowthPolicy>
 class Vector : protected Allocator
 {
 public:
     using ValueType = T;
     using AllocatorType = Allocator;
+    using GrowthPolicyType = GrowthPolicy;
 
     using Iterator = RandomAccessIterator<T>;
     using ConstIterator = RandomAccessIterator<const T>;
@@ -40,8 +44,8 @@ public:
 	Vector(InIterator First, InIterator Last, const Allocator& InAllocator = Allocator());
 
 	// TODO
-	template <class OtherAllocator>
-    Vector(const Vector<T, OtherAllocator>& Other, const Allocator& InAllocator = Allocator()) requires Concepts::CopyConstructible<T>;
+	template <class OtherAllocator, class OtherGrowthPolicy>
+    Vector(const Vector<T, OtherAllocator, OtherGrowthPolicy>& Other, const Allocator& InAllocator = Allocator()) requires Concepts::CopyConstructible<T>;
 
 	// TODO
 	Vector(const Vector& Other) requires Concepts::CopyConstructible<T>;
@@ -53,8 +57,8 @@ public:
 	~Vector();
 
 	// TODO
-	template <class OtherAllocator>
-    Vector& operator=(const Vector<T, OtherAllocator>& Other) requires Concepts::CopyConstructible<T>;
+	template <class OtherAllocator, class OtherGrowthPolicy>
+    Vector& operator=(const Vector<T, OtherAllocator, OtherGrowthPolicy>& Other) requires Concepts::CopyConstructible<T>;
 
 	// TODO
     Vector& operator=(Vector&& Other);
@@ -78,6 +82,10 @@ public:
     // Resize the container to the given Size. New elements are copied from the specified object.
     void Resize(size_t Size, const T& Value);
 
+    // Resize the container to the given Size. New elements are left uninitialized and must be written before they're
+    // read, e.g. by reading from a file or a socket directly into the container. Saves a pass over the new memory.
+    void ResizeUninitialized(size_t Size) requires TypeTraits::IsImplicitLifetime<T>;
+
     // Allocate at least the given number of elements in the container.
     // If the current capacity is already equal or greater, the function does nothing.
     void Reserve(size_t Capacity);
@@ -101,8 +109,16 @@ public:
     // `first` must be valid and dereferenceable. `last` must be valid.
     Iterator Erase(ConstIterator First, ConstIterator Last);
 
-	// TODO: Append containers, views, and arrays with known size.
-	// TODO: Append InIterator first, InIterator last
+    // Add copies of all elements of the given contiguous container, view, or array to the end, e.g. `ArrayView`,
+    // `Array`, `Vector` with any allocator, or a C array. Memory is reserved at most once. The given container must
+    // not reference this container.
+    template <ContiguousIterable<T> Container>
+    void Append(const Container& Value);
+
+    // Add copies of the given range of objects to the end. Memory is reserved at most once. The range must be valid
+    // and must not reference this container.
+    template <ForwardIterator<T> InIterator>
+    void Append(InIterator First, InIterator Last);
 
     // Add an element to the end.
     void PushBack(const T& Value);
@@ -112,6 +128,10 @@ public:
     template <class... Args>
     T& EmplaceBack(Args&&... Args);
 
+    // Add the given number of uninitialized elements to the end and return the address of the first one. New elements
+    // must be written before they're read. Grows the container like `PushBack`, so repeated appends are amortized.
+    T* AppendUninitialized(size_t Count) requires TypeTraits::IsImplicitLifetime<T>;
+
     // Remove the last element. The container must not be empty.
     void PopBack();
 
@@ -169,7 +189,27 @@ public:
     // Return the associated allocator.
     const Allocator& GetAllocator() const;
 
-	// TODO: <=>
+    // Return an iterator to the first element equal to the given value, or the end iterator if there's none.
+    Iterator Find(const T& Value);
+    ConstIterator Find(const T& Value) const;
+
+    // Return whether the container contains an element equal to the given value.
+    bool Contains(const T& Value) const;
+
+    // Return how many elements are equal to the given value.
+    size_t Count(const T& Value) const;
+
+    // Return the first smallest element. The container must not be empty.
+    const T& GetMin() const;
+
+    // Return the first largest element. The container must not be empty.
+    const T& GetMax() const;
+
+    // Return whether two containers have equal elements.
+    bool operator==(const Vector& Other) const;
+
+    // Lexicographically compare two containers.
+    std::weak_ordering operator<=>(const Vector& Other) const;
 
 protected:
     void DefaultInit(size_t Size);
@@ -183,6 +223,7 @@ protected:
     void ValueConstructRange(T* Data, const T& Value, size_t Size);
     void CopyConstructRange(T* Dst, const T* Src, size_t Size);
     void MoveConstructRange(T* Dst, T* Src, size_t Size);
+    void RelocateRange(T* Dst, T* Src, size_t Size);
 
     template <class InIterator>
     void IteratorConstructRange(T* Dst, InIterator Src, size_t Size);
@@ -200,7 +241,9 @@ protected:
 
     void DestroyAllAndDeallocate();
     void AssignFromMemory(const T* Data, size_t Size);
+    void AppendFromMemory(const T* Data, size_t Size);
     void ReserveUnchecked(size_t Capacity);
+    size_t GetGrowthCapacity(size_t RequiredCapacity) const;
     void ShiftElementsRight(ptrdiff_t Index);
 
     T* m_data;
@@ -4,16 +4,16 @@
 
 namespace kw {
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector()
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector()
     : m_data(nullptr)
     , m_size(0)
     , m_capacity(0)
 {
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(const Allocator& allocator)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(const Allocator& allocator)
     : Allocator(allocator)
     , m_data(nullptr)
     , m_size(0)
@@ -21,21 +21,21 @@ Vector<T, Allocator>::Vector(const Allocator& allocator)
 {
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(size_t count)
 {
     DefaultInit(count);
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(size_t count, const Allocator& allocator)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(size_t count, const Allocator& allocator)
     : Allocator(allocator)
 {
     DefaultInit(count);
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::DefaultInit(size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::DefaultInit(size_t count)
 {
     if (count != 0)
     {
@@ -53,21 +53,21 @@ inline void Vector<T, Allocator>::DefaultInit(size_t count)
     }
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(size_t count, const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(size_t count, const T& value)
 {
     ValueInit(count, value);
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(size_t count, const T& value, const Allocator& allocator)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(size_t count, const T& value, const Allocator& allocator)
     : Allocator(allocator)
 {
     ValueInit(count, value);
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::ValueInit(size_t count, const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::ValueInit(size_t count, const T& value)
 {
     if (count != 0)
     {
@@ -85,21 +85,21 @@ inline void Vector<T, Allocator>::ValueInit(size_t count, const T& value)
     }
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(std::initializer_list<T> list)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(std::initializer_list<T> list)
 {
     CopyInit(list.begin(), list.size());
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(std::initializer_list<T> list, const Allocator& allocator)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(std::initializer_list<T> list, const Allocator& allocator)
     : Allocator(allocator)
 {
     CopyInit(list.begin(), list.size());
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::CopyInit(const T* data, size_t size)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::CopyInit(const T* data, size_t size)
 {
     if (size != 0)
     {
@@ -117,24 +117,24 @@ inline void Vector<T, Allocator>::CopyInit(const T* data, size_t size)
     }
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-Vector<T, Allocator>::Vector(InIterator first, InIterator last)
+Vector<T, Allocator, GrowthPolicy>::Vector(InIterator first, InIterator last)
 {
     IteratorInit(first, last);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-Vector<T, Allocator>::Vector(InIterator first, InIterator last, const Allocator& allocator)
+Vector<T, Allocator, GrowthPolicy>::Vector(InIterator first, InIterator last, const Allocator& allocator)
     : Allocator(allocator)
 {
     IteratorInit(first, last);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-inline void Vector<T, Allocator>::IteratorInit(InIterator first, InIterator last)
+inline void Vector<T, Allocator, GrowthPolicy>::IteratorInit(InIterator first, InIterator last)
 {
     size_t count = Iterators::GetDistance(first, last);
     if (count != 0)
@@ -153,15 +153,15 @@ inline void Vector<T, Allocator>::IteratorInit(InIterator first, InIterator last
     }
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(const Vector& other) requires Concepts::CopyConstructible<T>
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(const Vector& other) requires Concepts::CopyConstructible<T>
     : Allocator(other)
 {
     CopyInit(other.GetData(), other.GetSize());
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(Vector&& other)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Vector(Vector&& other)
     : Allocator(Move(other))
     , m_data(other.m_data)
     , m_size(other.m_size)
@@ -172,14 +172,14 @@ Vector<T, Allocator>::Vector(Vector&& other)
     other.m_capacity = 0;
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::~Vector()
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::~Vector()
 {
     DestroyAllAndDeallocate();
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::DestroyAllAndDeallocate()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::DestroyAllAndDeallocate()
 {
     DestroyRange(m_data, m_size);
 
@@ -187,8 +187,8 @@ inline void Vector<T, Allocator>::DestroyAllAndDeallocate()
     Allocator::Deallocate(m_data);
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector& other) requires Concepts::CopyConstructible<T>
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>& Vector<T, Allocator, GrowthPolicy>::operator=(const Vector& other) requires Concepts::CopyConstructible<T>
 {
     // Currently, the allocator is not propagated from copy assignment.
 
@@ -209,8 +209,8 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector& other) requi
     return *this;
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::AssignFromMemory(const T* data, size_t size)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::AssignFromMemory(const T* data, size_t size)
 {
     if (size > m_size)
     {
@@ -234,8 +234,8 @@ inline void Vector<T, Allocator>::AssignFromMemory(const T* data, size_t size)
     m_size = size;
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& other)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>& Vector<T, Allocator, GrowthPolicy>::operator=(Vector&& other)
 {
     // Currently, the allocator is not propagated from move assignment.
 
@@ -255,8 +255,8 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& other)
     return *this;
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(std::initializer_list<T> list)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>& Vector<T, Allocator, GrowthPolicy>::operator=(std::initializer_list<T> list)
 {
     // Currently, the allocator is not propagated from copy assignment.
 
@@ -274,8 +274,8 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(std::initializer_list<T> l
     return *this;
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Assign(size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Assign(size_t count)
 {
     if (count > m_capacity)
     {
@@ -309,8 +309,8 @@ void Vector<T, Allocator>::Assign(size_t count)
     }
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Assign(size_t count, const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Assign(size_t count, const T& value)
 {
     if (count > m_capacity)
     {
@@ -377,8 +377,8 @@ void Vector<T, Allocator>::Assign(size_t count, const T& value)
     }
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Resize(size_t size)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Resize(size_t size)
 {
     if (size > m_size)
     {
@@ -399,8 +399,8 @@ void Vector<T, Allocator>::Resize(size_t size)
     }
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Resize(size_t size, const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Resize(size_t size, const T& value)
 {
     if (size > m_size)
     {
@@ -421,8 +421,21 @@ void Vector<T, Allocator>::Resize(size_t size, const T& value)
     }
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Reserve(size_t capacity)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::ResizeUninitialized(size_t size) requires TypeTraits::IsImplicitLifetime<T>
+{
+    if (size > m_capacity)
+    {
+        ReserveUnchecked(size);
+    }
+
+    // Implicit-lifetime types don't need constructor calls. Shrinking doesn't need destructor calls either,
+    // because implicit-lifetime classes are trivially destructible.
+    m_size = size;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Reserve(size_t capacity)
 {
     if (capacity > m_capacity)
     {
@@ -430,28 +443,56 @@ void Vector<T, Allocator>::Reserve(size_t capacity)
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::ReserveUnchecked(size_t capacity)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::ReserveUnchecked(size_t capacity)
 {
-    T* newData = Allocator::Allocate(capacity);
+    if constexpr (ExpandableAllocator<Allocator, T>)
+    {
+        // Growing in-place doesn't touch the elements at all, so it's valid for any type.
+        if (m_data != nullptr && Allocator::TryExpand(m_data, m_capacity, capacity))
+        {
+            m_capacity = capacity;
+            return;
+        }
+    }
+
+    if constexpr (ReallocatableAllocator<Allocator, T> && TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        // The allocator may move the bytes to a new block, which is a valid relocation for this type. Huge buffers
+        // are often grown without a copy and without having both old and new blocks alive at the same time.
+        m_data = Allocator::Reallocate(m_data, m_capacity, capacity);
+    }
+    else
+    {
+        T* newData = Allocator::Allocate(capacity);
 
-    MoveConstructRange(newData, m_data, m_size);
+        // Source elements are destroyed by the relocation, only the memory is left to deallocate.
+        RelocateRange(newData, m_data, m_size);
 
-    DestroyAllAndDeallocate();
+        // `Deallocate` must handle `nullptr` by design.
+        Allocator::Deallocate(m_data);
+
+        m_data = newData;
+    }
 
-    m_data = newData;
     m_capacity = capacity;
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::Clear()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline size_t Vector<T, Allocator, GrowthPolicy>::GetGrowthCapacity(size_t requiredCapacity) const
+{
+    return GrowthPolicy::template GetCapacity<T>(m_capacity, requiredCapacity, GetAllocator());
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::Clear()
 {
     DestroyRange(m_data, m_size);
     m_size = 0;
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterator, const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Insert(ConstIterator iterator, const T& value)
 {
     if (iterator != GetConstEnd())
     {
@@ -460,15 +501,23 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
 
         if (m_size == m_capacity)
         {
-            ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+            ReserveUnchecked(GetGrowthCapacity(m_size + 1));
         }
 
-        // Move-constructs one element in the end, move-assignes the rest.
+        // Relocates the tail when possible, otherwise move-constructs one element in the end and move-assignes the rest.
         ShiftElementsRight(index);
 
-        // Since insertion happens not in the end, this element was constructed sometime earlier
-        // and just recently was move-assigned to the next element.
-        m_data[index] = value;
+        if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+        {
+            // The element that used to be here was relocated to the next position, this memory is uninitialized now.
+            new (m_data + index) T(value);
+        }
+        else
+        {
+            // Since insertion happens not in the end, this element was constructed sometime earlier
+            // and just recently was move-assigned to the next element.
+            m_data[index] = value;
+        }
 
         return Iterator(m_data + index);
     }
@@ -479,8 +528,8 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
     }
 }
 
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterator, T&& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Insert(ConstIterator iterator, T&& value)
 {
     if (iterator != GetConstEnd())
     {
@@ -489,15 +538,23 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
 
         if (m_size == m_capacity)
         {
-            ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+            ReserveUnchecked(GetGrowthCapacity(m_size + 1));
         }
 
-        // Move-constructs one element in the end, move-assignes the rest.
+        // Relocates the tail when possible, otherwise move-constructs one element in the end and move-assignes the rest.
         ShiftElementsRight(index);
 
-        // Since insertion happens not in the end, this element was constructed sometime earlier
-        // and just recently was move-assigned to the next element.
-        m_data[index] = Move(value);
+        if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+        {
+            // The element that used to be here was relocated to the next position, this memory is uninitialized now.
+            new (m_data + index) T(Move(value));
+        }
+        else
+        {
+            // Since insertion happens not in the end, this element was constructed sometime earlier
+            // and just recently was move-assigned to the next element.
+            m_data[index] = Move(value);
+        }
 
         return Iterator(m_data + index);
     }
@@ -508,10 +565,15 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::ShiftElementsRight(ptrdiff_t index)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::ShiftElementsRight(ptrdiff_t index)
 {
-    if constexpr (TypeTraits::isTriviallyMoveConstructible<T> &&
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        // Relocate the tail one position right. The element at `index` is left uninitialized.
+        Memory::Memmove(m_data + index + 1, m_data + index, sizeof(T) * (m_size - index));
+    }
+    else if constexpr (TypeTraits::isTriviallyMoveConstructible<T> &&
                   TypeTraits::isTriviallyMoveAssignable<T>)
     {
         // No need to separate construction and assignment here.
@@ -529,9 +591,9 @@ inline void Vector<T, Allocator>::ShiftElementsRight(ptrdiff_t index)
     m_size++;
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterator, InIterator first, InIterator last)
+Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Insert(ConstIterator iterator, InIterator first, InIterator last)
 {
     // `ReserveUnchecked` invalidates iterators and addresses. Work with an index instead.
     ptrdiff_t index = iterator - GetConstBegin();
@@ -541,12 +603,17 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
     size_t requiredCapacity = m_size + count;
     if (requiredCapacity > m_capacity)
     {
-        size_t desiredCapacity = m_capacity * 2;
-        ReserveUnchecked(desiredCapacity > requiredCapacity ? desiredCapacity : requiredCapacity);
+        ReserveUnchecked(GetGrowthCapacity(requiredCapacity));
     }
 
     // Check if we're inserting in the end. The end insertion is significantly simpler.
-    if (index != m_size)
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        // Relocate the tail right in one go and construct the new elements in the uninitialized gap.
+        Memory::Memmove(m_data + index + count, m_data + index, sizeof(T) * (m_size - index));
+        IteratorConstructRange(m_data + index, first, count);
+    }
+    else if (index != m_size)
     {
         T* end = m_data + m_size;
         T* newEnd = end + count;
@@ -588,8 +655,8 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Insert(ConstIterator iterat
 }
 
 // TODO: Refactor this.
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Iterator Vector<T, Allocator>::Erase(ConstIterator iterator)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Erase(ConstIterator iterator)
 {
     // This trick is just to get rid of `const` specifier required by the interface. It's optimized away.
     T* curr = m_data + (iterator - GetConstBegin());
@@ -599,29 +666,38 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Erase(ConstIterator iterato
 
     m_size--;
 
-    if constexpr (!TypeTraits::isTriviallyMoveAssignable<T>)
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
     {
-        for (; next != end; curr = next, next++)
-        {
-            *curr = Move(*next);
-        }
+        // Destroy the erased element and relocate the tail over it. No move assignments needed.
+        DestroyRange(curr, 1);
+        Memory::Memmove(curr, next, sizeof(T) * (end - next));
     }
     else
     {
-        Memory::Memcpy(curr, next, sizeof(T) * (end - next));
-    }
+        if constexpr (!TypeTraits::isTriviallyMoveAssignable<T>)
+        {
+            for (; next != end; curr = next, next++)
+            {
+                *curr = Move(*next);
+            }
+        }
+        else
+        {
+            Memory::Memcpy(curr, next, sizeof(T) * (end - next));
+        }
 
-    if constexpr (!TypeTraits::isTriviallyDestructible<T>)
-    {
-        curr->~T();
+        if constexpr (!TypeTraits::isTriviallyDestructible<T>)
+        {
+            curr->~T();
+        }
     }
 
     return Iterator(result);
 }
 
 // TODO: Refactor this.
-template <typename T, typename Allocator>
-Vector<T, Allocator>::Iterator Vector<T, Allocator>::Erase(ConstIterator first, ConstIterator last)
+template <typename T, typename Allocator, typename GrowthPolicy>
+Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Erase(ConstIterator first, ConstIterator last)
 {
     // This trick is just to get rid of `const` specifier required by the interface. It's optimized away.
     T* first2 = m_data + (first - GetConstBegin());
@@ -631,68 +707,139 @@ Vector<T, Allocator>::Iterator Vector<T, Allocator>::Erase(ConstIterator first,
 
     m_size -= last2 - first2;
 
-    if constexpr (!TypeTraits::isTriviallyMoveAssignable<T>)
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
     {
-        for (; last2 != end; first2++, last2++)
-        {
-            *first2 = Move(*last2);
-        }
+        // Destroy the erased elements and relocate the tail over them. No move assignments needed.
+        DestroyRange(first2, last2 - first2);
+        Memory::Memmove(first2, last2, sizeof(T) * (end - last2));
     }
     else
     {
-        Memory::Memcpy(first2, last2, sizeof(T) * (end - last2));
-    }
+        if constexpr (!TypeTraits::isTriviallyMoveAssignable<T>)
+        {
+            for (; last2 != end; first2++, last2++)
+            {
+                *first2 = Move(*last2);
+            }
+        }
+        else
+        {
+            Memory::Memcpy(first2, last2, sizeof(T) * (end - last2));
+        }
 
-    if constexpr (!TypeTraits::isTriviallyDestructible<T>)
-    {
-        for (; first2 != end; first2++)
+        if constexpr (!TypeTraits::isTriviallyDestructible<T>)
         {
-            first2->~T();
+            for (; first2 != end; first2++)
+            {
+                first2->~T();
+            }
         }
     }
 
     return Iterator(result);
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::PushBack(const T& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <ContiguousIterable<T> Container>
+void Vector<T, Allocator, GrowthPolicy>::Append(const Container& container)
+{
+    auto first = ContainerUtils::GetBegin(container);
+    size_t count = ContainerUtils::GetEnd(container) - first;
+
+    // Empty views may point to null, don't dereference their begin iterator.
+    if (count != 0)
+    {
+        AppendFromMemory(&*first, count);
+    }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::AppendFromMemory(const T* data, size_t count)
+{
+    size_t requiredCapacity = m_size + count;
+    if (requiredCapacity > m_capacity)
+    {
+        ReserveUnchecked(GetGrowthCapacity(requiredCapacity));
+    }
+
+    // Single Memcpy for trivially copy-constructible types.
+    CopyConstructRange(m_data + m_size, data, count);
+
+    m_size = requiredCapacity;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <ForwardIterator<T> InIterator>
+void Vector<T, Allocator, GrowthPolicy>::Append(InIterator first, InIterator last)
+{
+    // Random access iterators compute the distance in constant time, others walk the range once.
+    size_t count = Iterators::GetDistance(first, last);
+
+    size_t requiredCapacity = m_size + count;
+    if (requiredCapacity > m_capacity)
+    {
+        ReserveUnchecked(GetGrowthCapacity(requiredCapacity));
+    }
+
+    // Single Memcpy for trivially copy-constructible types and random access iterators.
+    IteratorConstructRange(m_data + m_size, first, count);
+
+    m_size = requiredCapacity;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::PushBack(const T& value)
 {
     if (m_size == m_capacity)
     {
-        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+        ReserveUnchecked(GetGrowthCapacity(m_size + 1));
     }
 
     new (m_data + m_size) T(value);
     m_size++;
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::PushBack(T&& value)
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::PushBack(T&& value)
 {
     if (m_size == m_capacity)
     {
-        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+        ReserveUnchecked(GetGrowthCapacity(m_size + 1));
     }
 
     new (m_data + m_size) T(Move(value));
     m_size++;
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename... Args>
-T& Vector<T, Allocator>::EmplaceBack(Args&&... args)
+T& Vector<T, Allocator, GrowthPolicy>::EmplaceBack(Args&&... args)
 {
     if (m_size == m_capacity)
     {
-        ReserveUnchecked(m_capacity > 0 ? m_capacity * 2 : 1);
+        ReserveUnchecked(GetGrowthCapacity(m_size + 1));
     }
 
     new (m_data + m_size) T(Forward(args)...);
     return m_data[m_size++];
 }
 
-template <typename T, typename Allocator>
-void Vector<T, Allocator>::PopBack()
+template <typename T, typename Allocator, typename GrowthPolicy>
+T* Vector<T, Allocator, GrowthPolicy>::AppendUninitialized(size_t count) requires TypeTraits::IsImplicitLifetime<T>
+{
+    size_t requiredCapacity = m_size + count;
+    if (requiredCapacity > m_capacity)
+    {
+        ReserveUnchecked(GetGrowthCapacity(requiredCapacity));
+    }
+
+    T* result = m_data + m_size;
+    m_size = requiredCapacity;
+    return result;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void Vector<T, Allocator, GrowthPolicy>::PopBack()
 {
     if constexpr (!TypeTraits::isTriviallyDestructible<T>)
     {
@@ -701,176 +848,225 @@ void Vector<T, Allocator>::PopBack()
     m_size--;
 }
 
-template <typename T, typename Allocator>
-inline T& Vector<T, Allocator>::operator[](size_t index)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline T& Vector<T, Allocator, GrowthPolicy>::operator[](size_t index)
 {
     return m_data[index];
 }
 
-template <typename T, typename Allocator>
-inline const T& Vector<T, Allocator>::operator[](size_t index) const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T& Vector<T, Allocator, GrowthPolicy>::operator[](size_t index) const
 {
     return m_data[index];
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::Iterator Vector<T, Allocator>::GetBegin()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::GetBegin()
 {
     return Iterator(m_data);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::GetBegin() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::GetBegin() const
 {
     return ConstIterator(m_data);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::GetConstBegin() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::GetConstBegin() const
 {
     return ConstIterator(m_data);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::Iterator Vector<T, Allocator>::GetEnd()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::GetEnd()
 {
     return Iterator(m_data + m_size);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::GetEnd() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::GetEnd() const
 {
     return ConstIterator(m_data + m_size);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::GetConstEnd() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::GetConstEnd() const
 {
     return ConstIterator(m_data + m_size);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ReverseIterator Vector<T, Allocator>::GetReverseBegin()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ReverseIterator Vector<T, Allocator, GrowthPolicy>::GetReverseBegin()
 {
     return ReverseIterator(Iterator(m_data + m_size - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstReverseIterator Vector<T, Allocator>::GetReverseBegin() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstReverseIterator Vector<T, Allocator, GrowthPolicy>::GetReverseBegin() const
 {
     return ConstReverseIterator(ConstIterator(m_data + m_size - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstReverseIterator Vector<T, Allocator>::GetConstReverseBegin() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstReverseIterator Vector<T, Allocator, GrowthPolicy>::GetConstReverseBegin() const
 {
     return ConstReverseIterator(ConstIterator(m_data + m_size - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ReverseIterator Vector<T, Allocator>::GetReverseEnd()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ReverseIterator Vector<T, Allocator, GrowthPolicy>::GetReverseEnd()
 {
     return ReverseIterator(Iterator(m_data - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstReverseIterator Vector<T, Allocator>::GetReverseEnd() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstReverseIterator Vector<T, Allocator, GrowthPolicy>::GetReverseEnd() const
 {
     return ConstReverseIterator(ConstIterator(m_data - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstReverseIterator Vector<T, Allocator>::GetConstReverseEnd() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstReverseIterator Vector<T, Allocator, GrowthPolicy>::GetConstReverseEnd() const
 {
     return ConstReverseIterator(ConstIterator(m_data - 1));
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::Iterator Vector<T, Allocator>::begin()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::begin()
 {
     return Iterator(m_data);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::begin() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::begin() const
 {
     return ConstIterator(m_data);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::Iterator Vector<T, Allocator>::end()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::end()
 {
     return Iterator(m_data + m_size);
 }
 
-template <typename T, typename Allocator>
-inline Vector<T, Allocator>::ConstIterator Vector<T, Allocator>::end() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::end() const
 {
     return ConstIterator(m_data + m_size);
 }
 
-template <typename T, typename Allocator>
-inline bool Vector<T, Allocator>::IsEmpty() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline bool Vector<T, Allocator, GrowthPolicy>::IsEmpty() const
 {
     return m_size == 0;
 }
 
-template <typename T, typename Allocator>
-inline size_t Vector<T, Allocator>::GetSize() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline size_t Vector<T, Allocator, GrowthPolicy>::GetSize() const
 {
     return m_size;
 }
 
-template <typename T, typename Allocator>
-inline size_t Vector<T, Allocator>::GetCapacity() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline size_t Vector<T, Allocator, GrowthPolicy>::GetCapacity() const
 {
     return m_capacity;
 }
 
-template <typename T, typename Allocator>
-inline T& Vector<T, Allocator>::GetFront()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline T& Vector<T, Allocator, GrowthPolicy>::GetFront()
 {
     return m_data[0];
 }
 
-template <typename T, typename Allocator>
-inline const T& Vector<T, Allocator>::GetFront() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T& Vector<T, Allocator, GrowthPolicy>::GetFront() const
 {
     return m_data[0];
 }
 
-template <typename T, typename Allocator>
-inline T& Vector<T, Allocator>::GetBack()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline T& Vector<T, Allocator, GrowthPolicy>::GetBack()
 {
     return m_data[m_size - 1];
 }
 
-template <typename T, typename Allocator>
-inline const T& Vector<T, Allocator>::GetBack() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T& Vector<T, Allocator, GrowthPolicy>::GetBack() const
 {
     return m_data[m_size - 1];
 }
 
-template <typename T, typename Allocator>
-inline T* Vector<T, Allocator>::GetData()
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline T* Vector<T, Allocator, GrowthPolicy>::GetData()
 {
     return m_data;
 }
 
-template <typename T, typename Allocator>
-inline const T* Vector<T, Allocator>::GetData() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T* Vector<T, Allocator, GrowthPolicy>::GetData() const
 {
     return m_data;
 }
 
-template <typename T, typename Allocator>
-inline const Allocator& Vector<T, Allocator>::GetAllocator() const
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const Allocator& Vector<T, Allocator, GrowthPolicy>::GetAllocator() const
 {
     return *this;
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::DefaultConstructRange(T* data, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::Iterator Vector<T, Allocator, GrowthPolicy>::Find(const T& value)
+{
+    return Iterator(const_cast<T*>(Algorithms::Find(m_data, m_size, value)));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline Vector<T, Allocator, GrowthPolicy>::ConstIterator Vector<T, Allocator, GrowthPolicy>::Find(const T& value) const
+{
+    return ConstIterator(Algorithms::Find(m_data, m_size, value));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline bool Vector<T, Allocator, GrowthPolicy>::Contains(const T& value) const
+{
+    return Algorithms::Find(m_data, m_size, value) != m_data + m_size;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline size_t Vector<T, Allocator, GrowthPolicy>::Count(const T& value) const
+{
+    return Algorithms::Count(m_data, m_size, value);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T& Vector<T, Allocator, GrowthPolicy>::GetMin() const
+{
+    return Algorithms::Min(m_data, m_size);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline const T& Vector<T, Allocator, GrowthPolicy>::GetMax() const
+{
+    return Algorithms::Max(m_data, m_size);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline bool Vector<T, Allocator, GrowthPolicy>::operator==(const Vector& other) const
+{
+    return m_size == other.m_size && Algorithms::Equal(m_data, other.m_data, m_size);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline std::weak_ordering Vector<T, Allocator, GrowthPolicy>::operator<=>(const Vector& other) const
+{
+    int result = Algorithms::Compare(m_data, m_size, other.m_data, other.m_size);
+    return result < 0 ? std::weak_ordering::less : (result > 0 ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::DefaultConstructRange(T* data, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyDefaultConstructible<T>)
     {
@@ -885,8 +1081,8 @@ inline void Vector<T, Allocator>::DefaultConstructRange(T* data, size_t count)
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::ValueConstructRange(T* data, const T& value, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::ValueConstructRange(T* data, const T& value, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyConstructible<T> &&
                   sizeof(T) == 1)
@@ -916,8 +1112,8 @@ inline void Vector<T, Allocator>::ValueConstructRange(T* data, const T& value, s
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::CopyConstructRange(T* dst, const T* src, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::CopyConstructRange(T* dst, const T* src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyConstructible<T>)
     {
@@ -932,8 +1128,8 @@ inline void Vector<T, Allocator>::CopyConstructRange(T* dst, const T* src, size_
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::MoveConstructRange(T* dst, T* src, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::MoveConstructRange(T* dst, T* src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyMoveConstructible<T>)
     {
@@ -948,9 +1144,24 @@ inline void Vector<T, Allocator>::MoveConstructRange(T* dst, T* src, size_t coun
     }
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::RelocateRange(T* dst, T* src, size_t count)
+{
+    if constexpr (TypeTraits::IsTriviallyRelocatable<T>)
+    {
+        // No per-element move constructor or destructor calls, the bytes are simply moved to the new address.
+        Memory::Memcpy(dst, src, sizeof(T) * count);
+    }
+    else
+    {
+        MoveConstructRange(dst, src, count);
+        DestroyRange(src, count);
+    }
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-inline void Vector<T, Allocator>::IteratorConstructRange(T* dst, InIterator src, size_t count)
+inline void Vector<T, Allocator, GrowthPolicy>::IteratorConstructRange(T* dst, InIterator src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyConstructible<T> &&
                   Iterators::isRandomAccessIterator<InIterator>)
@@ -966,8 +1177,8 @@ inline void Vector<T, Allocator>::IteratorConstructRange(T* dst, InIterator src,
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::DefaultAssignRange(T* data, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::DefaultAssignRange(T* data, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyDefaultConstructible<T> &&
                   TypeTraits::isTriviallyCopyAssignable<T>)
@@ -983,8 +1194,8 @@ inline void Vector<T, Allocator>::DefaultAssignRange(T* data, size_t count)
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::ValueAssignRange(T* data, const T& value, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::ValueAssignRange(T* data, const T& value, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyConstructible<T> &&
                   TypeTraits::isTriviallyCopyAssignable<T> &&
@@ -1015,8 +1226,8 @@ inline void Vector<T, Allocator>::ValueAssignRange(T* data, const T& value, size
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::CopyAssignRange(T* dst, const T* src, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::CopyAssignRange(T* dst, const T* src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyAssignable<T>)
     {
@@ -1031,8 +1242,8 @@ inline void Vector<T, Allocator>::CopyAssignRange(T* dst, const T* src, size_t c
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::MoveAssignRange(T* dst, T* src, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::MoveAssignRange(T* dst, T* src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyMoveAssignable<T>)
     {
@@ -1047,8 +1258,8 @@ inline void Vector<T, Allocator>::MoveAssignRange(T* dst, T* src, size_t count)
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::MoveAssignOverlappedRange(T* dst, T* src, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::MoveAssignOverlappedRange(T* dst, T* src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyMoveAssignable<T>)
     {
@@ -1063,9 +1274,9 @@ inline void Vector<T, Allocator>::MoveAssignOverlappedRange(T* dst, T* src, size
     }
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InIterator>
-inline void Vector<T, Allocator>::IteratorAssignRange(T* dst, InIterator& src, size_t count)
+inline void Vector<T, Allocator, GrowthPolicy>::IteratorAssignRange(T* dst, InIterator& src, size_t count)
 {
     if constexpr (TypeTraits::isTriviallyCopyAssignable<T> &&
                   Iterators::isRandomAccessIterator<InIterator>)
@@ -1082,8 +1293,8 @@ inline void Vector<T, Allocator>::IteratorAssignRange(T* dst, InIterator& src, s
     }
 }
 
-template <typename T, typename Allocator>
-inline void Vector<T, Allocator>::DestroyRange(T* data, size_t count)
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline void Vector<T, Allocator, GrowthPolicy>::DestroyRange(T* data, size_t count)
 {
     if constexpr (!TypeTraits::isTriviallyDestructible<T>)
     {
@@ -1,9 +1,24 @@
 #define _CRT_SECURE_NO_WARNINGS
 
+#include "ConcurrentHashMap.h"
+#include "HashMap.h"
+#include "HashMultiMap.h"
+#include "NodeHashMap.h"
+#include "OrderedMap.h"
 #include "Vector.h"
+#include "SmallVector.h"
+#include "SegmentedVector.h"
+#include "SnapshotHashMap.h"
+#include "SoAVector.h"
 #include "Benchmark.h"
 #include "Macros.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 using namespace kw;
@@ -12,12 +27,19 @@ using namespace kw;
 
 static constexpr size_t smallStructSize = 32;
 static constexpr size_t bigStructSize = 256;
+static constexpr size_t smallVectorSize = 16;
 
 struct PodStruct
 {
     int data[smallStructSize];
 };
 
+// `PodStruct` without its first field, so `SoAVector<int, PodStructTail>` stores the same data as `PodStruct`.
+struct PodStructTail
+{
+    int data[smallStructSize - 1];
+};
+
 struct BigPodStruct
 {
     int data[bigStructSize];
@@ -140,6 +162,8 @@ KW_NOINLINE BigStruct& BigStruct::operator=(BigStruct&& other)
 static const size_t defaultSizes[] = { 8, 64, 512, 16384 };
 
 using DefaultTypes = kw::BenchmarkTypes<char, short, int, long long, PodStruct, BigPodStruct, Struct, BigStruct>;
+using PodTypes = kw::BenchmarkTypes<char, short, int, long long, PodStruct, BigPodStruct>;
+using ArithmeticTypes = kw::BenchmarkTypes<char, short, int, long long, float, double>;
 
 KW_BENCHMARK_TEMPLATE(KwVectorConstructorCount, DefaultTypes, defaultSizes)
 {
@@ -348,6 +372,1710 @@ KW_BENCHMARK_TEMPLATE(KwVectorPopBack, DefaultTypes, KW_LIST(1))
     KW_DONT_OPTIMIZE(value);
 }
 
+KW_BENCHMARK_TEMPLATE(KwVectorResize, PodTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value;
+    value.Resize(size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorResizeUninitialized, PodTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value;
+    value.ResizeUninitialized(size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorAppendUninitialized, PodTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(16);
+    T* data = value.AppendUninitialized(size);
+    KW_DONT_OPTIMIZE(data);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorAppendContainer, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> other(size);
+    Vector<T, BenchmarkAllocator<T>> value(16);
+    value.Append(other);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorAppendIterator, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> other(size);
+    Vector<T, BenchmarkAllocator<T>> value(16);
+    value.Append(other.GetBegin(), other.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorAppendPushBack, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> other(size);
+    Vector<T, BenchmarkAllocator<T>> value(16);
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(other[i]);
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorGrowthDoubling, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>, DoublingGrowthPolicy> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorGrowthOneAndHalf, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>, OneAndHalfGrowthPolicy> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorGrowthGoldenRatio, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>, GoldenRatioGrowthPolicy> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorGrowthPage, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>, PageGrowthPolicy<>> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorGrowthSizeClass, DefaultTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>, SizeClassGrowthPolicy<>> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSegmentedVectorPushBack, DefaultTypes, defaultSizes)
+{
+    SegmentedVector<T, 512, BenchmarkAllocator<T>> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSegmentedVectorIterate, DefaultTypes, defaultSizes)
+{
+    SegmentedVector<T, 512, BenchmarkAllocator<T>> value(size);
+    for (T& element : value)
+    {
+        KW_DONT_OPTIMIZE(element);
+    }
+}
+
+KW_BENCHMARK_TEMPLATE(KwSegmentedVectorIndex, DefaultTypes, defaultSizes)
+{
+    SegmentedVector<T, 512, BenchmarkAllocator<T>> value(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        KW_DONT_OPTIMIZE(value[i]);
+    }
+}
+
+static constexpr size_t scanPassCount = 16;
+static const size_t scanSizes[] = { 512, 16384, 262144 };
+
+using ScanTypes = kw::BenchmarkTypes<PodStruct>;
+
+KW_BENCHMARK_TEMPLATE(KwVectorScanField, ScanTypes, scanSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    int sum = 0;
+    for (size_t pass = 0; pass < scanPassCount; pass++)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            sum += value[i].data[0];
+        }
+    }
+    KW_DONT_OPTIMIZE(sum);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSoAVectorScanField, ScanTypes, scanSizes)
+{
+    SoAVector<int, PodStructTail> value(size);
+    const int* data = value.GetData<0>();
+    int sum = 0;
+    for (size_t pass = 0; pass < scanPassCount; pass++)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            sum += data[i];
+        }
+    }
+    KW_DONT_OPTIMIZE(sum);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSoAVectorScanIterator, ScanTypes, scanSizes)
+{
+    SoAVector<int, PodStructTail> value(size);
+    int sum = 0;
+    for (size_t pass = 0; pass < scanPassCount; pass++)
+    {
+        for (auto element : value)
+        {
+            sum += element.Get<0>();
+        }
+    }
+    KW_DONT_OPTIMIZE(sum);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorPushBackStruct, ScanTypes, scanSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(T());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSoAVectorPushBack, ScanTypes, scanSizes)
+{
+    SoAVector<int, PodStructTail> value;
+    for (size_t i = 0; i < size; i++)
+    {
+        value.PushBack(0, PodStructTail());
+    }
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorFind, ArithmeticTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    auto result = value.Find(T(1));
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorCount, ArithmeticTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    size_t result = value.Count(T(0));
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorEqual, ArithmeticTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    Vector<T, BenchmarkAllocator<T>> other(size);
+    bool result = value == other;
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorCompare, ArithmeticTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    Vector<T, BenchmarkAllocator<T>> other(size);
+    bool result = value < other;
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwVectorMin, ArithmeticTypes, defaultSizes)
+{
+    Vector<T, BenchmarkAllocator<T>> value(size);
+    T result = value.GetMin();
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Sizes are in bytes, from a few bytes to far beyond the last level cache.
+static const size_t memorySizes[] = { 8, 64, 512, 4096, 32768, 262144, 2097152, 16777216, 67108864 };
+
+using MemoryTypes = kw::BenchmarkTypes<char>;
+
+KW_BENCHMARK_TEMPLATE(KwMemcpy, MemoryTypes, memorySizes)
+{
+    T* src = static_cast<T*>(BenchmarkAllocate(size, 64));
+    T* dst = static_cast<T*>(BenchmarkAllocate(size, 64));
+    Memory::Memcpy(dst, src, size);
+    KW_DONT_OPTIMIZE(dst);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMemcpy, MemoryTypes, memorySizes)
+{
+    T* src = static_cast<T*>(BenchmarkAllocate(size, 64));
+    T* dst = static_cast<T*>(BenchmarkAllocate(size, 64));
+    memcpy(dst, src, size);
+    KW_DONT_OPTIMIZE(dst);
+}
+
+KW_BENCHMARK_TEMPLATE(KwMemmoveOverlapped, MemoryTypes, memorySizes)
+{
+    T* data = static_cast<T*>(BenchmarkAllocate(size + 1, 64));
+    Memory::Memmove(data + 1, data, size);
+    KW_DONT_OPTIMIZE(data);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMemmoveOverlapped, MemoryTypes, memorySizes)
+{
+    T* data = static_cast<T*>(BenchmarkAllocate(size + 1, 64));
+    memmove(data + 1, data, size);
+    KW_DONT_OPTIMIZE(data);
+}
+
+KW_BENCHMARK_TEMPLATE(KwMemset, MemoryTypes, memorySizes)
+{
+    T* dst = static_cast<T*>(BenchmarkAllocate(size, 64));
+    Memory::Memset(dst, 1, size);
+    KW_DONT_OPTIMIZE(dst);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMemset, MemoryTypes, memorySizes)
+{
+    T* dst = static_cast<T*>(BenchmarkAllocate(size, 64));
+    memset(dst, 1, size);
+    KW_DONT_OPTIMIZE(dst);
+}
+
+KW_BENCHMARK_TEMPLATE(KwMemcmp, MemoryTypes, memorySizes)
+{
+    T* lhs = static_cast<T*>(BenchmarkAllocate(size, 64));
+    T* rhs = static_cast<T*>(BenchmarkAllocate(size, 64));
+    int result = Memory::Memcmp(lhs, rhs, size);
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMemcmp, MemoryTypes, memorySizes)
+{
+    T* lhs = static_cast<T*>(BenchmarkAllocate(size, 64));
+    T* rhs = static_cast<T*>(BenchmarkAllocate(size, 64));
+    int result = memcmp(lhs, rhs, size);
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Table sizes from a table that fits into L1 to one far beyond the last level cache.
+static const size_t hashSizes[] = { 1024, 65536, 1048576, 10485760 };
+
+using HashTypes = kw::BenchmarkTypes<unsigned long long>;
+
+// Distinct keys without any pattern in their low bits. Missing keys are generated from indices past the table size.
+template <typename T>
+static T GetHashKey(size_t index)
+{
+    return static_cast<T>(index * 0xBF58476D1CE4E5B9ULL);
+}
+
+// Lookups visit keys in a scrambled order, so node based tables can't benefit from nodes allocated in insertion order.
+// 7919 is a prime, so it's coprime with all the sizes and the mapping is a permutation.
+static size_t GetLookupIndex(size_t index, size_t size)
+{
+    return index * 7919 % size;
+}
+
+// Same as `HashMap<T, T>`, but with control bytes probed in groups instead of Robin Hood distances.
+template <typename T>
+using SwissHashMap = HashMap<T, T, Hash<T>, EqualTo<T>, MallocAllocator<Pair<const T, T>>, SwissHashLayout>;
+
+// Same as `HashMap<T, T>`, but without any per slot metadata. The key with all bits set marks empty slots.
+template <typename T>
+using CompactHashMap = HashMap<T, T, Hash<T>, EqualTo<T>, MallocAllocator<Pair<const T, T>>, CompactHashLayout<>>;
+
+// Same as `HashMap<T, T>`, but the growth of the table is spread over the following insertions.
+template <typename T>
+using IncrementalHashMap = HashMap<T, T, Hash<T>, EqualTo<T>, MallocAllocator<Pair<const T, T>>, IncrementalHashLayout<>>;
+
+// Same as `IncrementalHashMap<T>`, but on top of the Robin Hood layout, which initializes the new table's distances.
+template <typename T>
+using IncrementalRobinHoodHashMap = HashMap<T, T, Hash<T>, EqualTo<T>, MallocAllocator<Pair<const T, T>>, IncrementalHashLayout<RobinHoodHashLayout>>;
+
+// Lookup benchmarks share a table that is built once per size, so the first run of each size includes construction.
+template <typename Map>
+static const Map& GetKwHashMap(size_t size)
+{
+    using T = typename Map::KeyType;
+
+    static Map map;
+    if (map.GetSize() != size)
+    {
+        map = Map();
+        for (size_t i = 0; i < size; i++)
+        {
+            map.Insert({ GetHashKey<T>(i), T(i) });
+        }
+    }
+    return map;
+}
+
+template <typename T>
+static const std::unordered_map<T, T>& GetStdUnorderedMap(size_t size)
+{
+    static std::unordered_map<T, T> map;
+    if (map.size() != size)
+    {
+        map = std::unordered_map<T, T>();
+        for (size_t i = 0; i < size; i++)
+        {
+            map.insert({ GetHashKey<T>(i), T(i) });
+        }
+    }
+    return map;
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapInsert, HashTypes, hashSizes)
+{
+    HashMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMapInsert, HashTypes, hashSizes)
+{
+    std::unordered_map<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindHit, HashTypes, hashSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Hashes are computed and prefetched this many lookups ahead, so cache misses of consecutive lookups overlap.
+static const size_t hashPrefetchDistance = 8;
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindHitPrefetched, HashTypes, hashSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+
+    size_t hashes[hashPrefetchDistance];
+    for (size_t i = 0; i < hashPrefetchDistance && i < size; i++)
+    {
+        hashes[i] = map.GetHash(GetHashKey<T>(GetLookupIndex(i, size)));
+        map.Prefetch(hashes[i]);
+    }
+
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        size_t hash = hashes[i % hashPrefetchDistance];
+        if (i + hashPrefetchDistance < size)
+        {
+            hashes[i % hashPrefetchDistance] = map.GetHash(GetHashKey<T>(GetLookupIndex(i + hashPrefetchDistance, size)));
+            map.Prefetch(hashes[i % hashPrefetchDistance]);
+        }
+        result += map.FindWithHash(GetHashKey<T>(GetLookupIndex(i, size)), hash)->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMapFindHit, HashTypes, hashSizes)
+{
+    const std::unordered_map<T, T>& map = GetStdUnorderedMap<T>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.find(GetHashKey<T>(GetLookupIndex(i, size)))->second;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindMiss, HashTypes, hashSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + GetLookupIndex(i, size)));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMapFindMiss, HashTypes, hashSizes)
+{
+    const std::unordered_map<T, T>& map = GetStdUnorderedMap<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.count(GetHashKey<T>(size + GetLookupIndex(i, size)));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Includes construction of the table, subtract the insert benchmark to get the cost of erasure.
+KW_BENCHMARK_TEMPLATE(KwHashMapErase, HashTypes, hashSizes)
+{
+    HashMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Erase(GetHashKey<T>(i));
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMapErase, HashTypes, hashSizes)
+{
+    std::unordered_map<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.insert({ GetHashKey<T>(i), T(i) });
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        map.erase(GetHashKey<T>(i));
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapInsert, HashTypes, hashSizes)
+{
+    SwissHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapFindHit, HashTypes, hashSizes)
+{
+    const SwissHashMap<T>& map = GetKwHashMap<SwissHashMap<T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapFindMiss, HashTypes, hashSizes)
+{
+    const SwissHashMap<T>& map = GetKwHashMap<SwissHashMap<T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + GetLookupIndex(i, size)));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Includes construction of the table, subtract the insert benchmark to get the cost of erasure.
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapErase, HashTypes, hashSizes)
+{
+    SwissHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Erase(GetHashKey<T>(i));
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwCompactHashMapInsert, HashTypes, hashSizes)
+{
+    CompactHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// With the size known in advance, the table takes 8/7 of the memory of its elements.
+KW_BENCHMARK_TEMPLATE(KwCompactHashMapInsertReserved, HashTypes, hashSizes)
+{
+    CompactHashMap<T> map;
+    map.Reserve(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwCompactHashMapFindHit, HashTypes, hashSizes)
+{
+    const CompactHashMap<T>& map = GetKwHashMap<CompactHashMap<T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwCompactHashMapFindMiss, HashTypes, hashSizes)
+{
+    const CompactHashMap<T>& map = GetKwHashMap<CompactHashMap<T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + GetLookupIndex(i, size)));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Includes construction of the table, subtract the insert benchmark to get the cost of erasure.
+KW_BENCHMARK_TEMPLATE(KwCompactHashMapErase, HashTypes, hashSizes)
+{
+    CompactHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Erase(GetHashKey<T>(i));
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// Total time is comparable to `KwHashMapInsert`, but no single insertion moves more than a few elements.
+KW_BENCHMARK_TEMPLATE(KwIncrementalHashMapInsert, HashTypes, hashSizes)
+{
+    IncrementalHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwIncrementalRobinHoodHashMapInsert, HashTypes, hashSizes)
+{
+    IncrementalRobinHoodHashMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// The insertion that starts a migration allocates and initializes the new table the same way, so this is the worst
+// case latency of a single insertion into a table of twice smaller capacity.
+KW_BENCHMARK_TEMPLATE(KwIncrementalHashMapGrowth, HashTypes, hashSizes)
+{
+    IncrementalHashMap<T> map;
+    map.Reserve(size);
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwIncrementalRobinHoodHashMapGrowth, HashTypes, hashSizes)
+{
+    IncrementalRobinHoodHashMap<T> map;
+    map.Reserve(size);
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwIncrementalHashMapFindHit, HashTypes, hashSizes)
+{
+    const IncrementalHashMap<T>& map = GetKwHashMap<IncrementalHashMap<T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwNodeHashMapInsert, HashTypes, hashSizes)
+{
+    NodeHashMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwNodeHashMapFindHit, HashTypes, hashSizes)
+{
+    const NodeHashMap<T, T>& map = GetKwHashMap<NodeHashMap<T, T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Misses rarely get past the control bytes, so they shouldn't pay for the indirection.
+KW_BENCHMARK_TEMPLATE(KwNodeHashMapFindMiss, HashTypes, hashSizes)
+{
+    const NodeHashMap<T, T>& map = GetKwHashMap<NodeHashMap<T, T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + GetLookupIndex(i, size)));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Includes construction of the table, subtract the insert benchmark to get the cost of erasure.
+KW_BENCHMARK_TEMPLATE(KwNodeHashMapErase, HashTypes, hashSizes)
+{
+    NodeHashMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Erase(GetHashKey<T>(i));
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// Batched lookups target tables far beyond the last level cache, so the sizes go further than `hashSizes`.
+static const size_t hashBatchSizes[] = { 1024, 65536, 1048576, 10485760, 104857600 };
+
+// How many keys each batched lookup takes.
+static const size_t hashBatchSize = 1024;
+
+// Keys of the batch benchmarks in lookup order. Every other key is missing from the table.
+template <typename T>
+static const std::vector<T>& GetHashBatchKeys(size_t size)
+{
+    static std::vector<T> keys;
+    if (keys.size() != size)
+    {
+        keys.resize(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            keys[i] = GetHashKey<T>(GetLookupIndex(i, size) + (i % 2) * size);
+        }
+    }
+    return keys;
+}
+
+// One by one lookups of the same keys as the batched ones below.
+KW_BENCHMARK_TEMPLATE(KwHashMapContainsUnbatched, HashTypes, hashBatchSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+    const std::vector<T>& keys = GetHashBatchKeys<T>(size);
+
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(keys[i]);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapContainsBatch, HashTypes, hashBatchSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+    const std::vector<T>& keys = GetHashBatchKeys<T>(size);
+
+    bool found[hashBatchSize];
+    size_t result = 0;
+    for (size_t i = 0; i < size; i += hashBatchSize)
+    {
+        size_t count = std::min(size - i, hashBatchSize);
+        map.ContainsBatch(ArrayView<T>(keys.data() + i, keys.data() + i + count), found);
+        for (size_t j = 0; j < count; j++)
+        {
+            result += found[j];
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindBatch, HashTypes, hashBatchSizes)
+{
+    const HashMap<T, T>& map = GetKwHashMap<HashMap<T, T>>(size);
+    const std::vector<T>& keys = GetHashBatchKeys<T>(size);
+
+    typename HashMap<T, T>::ConstIterator found[hashBatchSize];
+    T result = T();
+    for (size_t i = 0; i < size; i += hashBatchSize)
+    {
+        size_t count = std::min(size - i, hashBatchSize);
+        map.FindBatch(ArrayView<T>(keys.data() + i, keys.data() + i + count), found);
+        for (size_t j = 0; j < count; j++)
+        {
+            if (found[j] != map.GetEnd())
+            {
+                result += found[j]->Value;
+            }
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapContainsUnbatched, HashTypes, hashBatchSizes)
+{
+    const SwissHashMap<T>& map = GetKwHashMap<SwissHashMap<T>>(size);
+    const std::vector<T>& keys = GetHashBatchKeys<T>(size);
+
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(keys[i]);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapContainsBatch, HashTypes, hashBatchSizes)
+{
+    const SwissHashMap<T>& map = GetKwHashMap<SwissHashMap<T>>(size);
+    const std::vector<T>& keys = GetHashBatchKeys<T>(size);
+
+    bool found[hashBatchSize];
+    size_t result = 0;
+    for (size_t i = 0; i < size; i += hashBatchSize)
+    {
+        size_t count = std::min(size - i, hashBatchSize);
+        map.ContainsBatch(ArrayView<T>(keys.data() + i, keys.data() + i + count), found);
+        for (size_t j = 0; j < count; j++)
+        {
+            result += found[j];
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Every run hashes the same amount of bytes split into keys of the given size, so throughput is comparable.
+static const size_t hashBytesTotal = 1048576;
+static const size_t hashBytesSizes[] = { 8, 16, 32, 64, 256, 4096, 65536 };
+
+KW_BENCHMARK_TEMPLATE(KwHashBytes, MemoryTypes, hashBytesSizes)
+{
+    T* data = static_cast<T*>(BenchmarkAllocate(hashBytesTotal, 64));
+    Memory::Memset(data, 1, hashBytesTotal);
+    size_t result = 0;
+    for (size_t offset = 0; offset < hashBytesTotal; offset += size)
+    {
+        result += HashBytes(data + offset, size);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Keys that collide under weak hashes: multiples of the page size, keys that differ in the top bits only, and keys
+// that the multiplier of Fibonacci hashing maps to consecutive integers. Slow lookups mean long probe sequences.
+template <typename T>
+static T GetStridedHashKey(size_t index)
+{
+    return static_cast<T>(index * 4096);
+}
+
+template <typename T>
+static T GetHighBitsHashKey(size_t index)
+{
+    return static_cast<T>(static_cast<unsigned long long>(index) << 40);
+}
+
+template <typename T>
+static T GetFibonacciInverseHashKey(size_t index)
+{
+    return static_cast<T>(index * 0xF1DE83E19937733DULL);
+}
+
+template <typename T, T (*GetKey)(size_t)>
+static const HashMap<T, T>& GetAdversarialHashMap(size_t size)
+{
+    static HashMap<T, T> map;
+    if (map.GetSize() != size)
+    {
+        map = HashMap<T, T>();
+        for (size_t i = 0; i < size; i++)
+        {
+            map.Insert({ GetKey(i), T(i) });
+        }
+    }
+    return map;
+}
+
+template <typename T, T (*GetKey)(size_t)>
+static T FindAdversarialHashKeys(size_t size)
+{
+    const HashMap<T, T>& map = GetAdversarialHashMap<T, GetKey>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetKey(GetLookupIndex(i, size)))->Value;
+    }
+    return result;
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindHitStrided, HashTypes, hashSizes)
+{
+    T result = FindAdversarialHashKeys<T, GetStridedHashKey<T>>(size);
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindHitHighBits, HashTypes, hashSizes)
+{
+    T result = FindAdversarialHashKeys<T, GetHighBitsHashKey<T>>(size);
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMapFindHitFibonacciInverse, HashTypes, hashSizes)
+{
+    T result = FindAdversarialHashKeys<T, GetFibonacciInverseHashKey<T>>(size);
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Multi key tables with skewed duplicates. Sizes stay small, because runs of equal keys in plain layouts make every
+// insertion of a duplicate linear in the number of its copies.
+static const size_t zipfSizes[] = { 1024, 16384, 262144 };
+
+// Keys with Zipf distributed duplicate counts: the key of rank r appears about size / (r * H) times, where H is the
+// harmonic number of the size, and the rare keys appear once. Keys are inserted in a scrambled order.
+template <typename T>
+static const std::vector<T>& GetZipfHashKeys(size_t size)
+{
+    static std::vector<T> keys;
+    if (keys.size() != size)
+    {
+        double harmonic = 0.0;
+        for (size_t rank = 1; rank <= size; rank++)
+        {
+            harmonic += 1.0 / static_cast<double>(rank);
+        }
+
+        std::vector<T> ordered;
+        for (size_t rank = 1; ordered.size() < size; rank++)
+        {
+            size_t count = std::max(static_cast<size_t>(static_cast<double>(size) / (static_cast<double>(rank) * harmonic)), size_t(1));
+            for (size_t i = 0; i < count && ordered.size() < size; i++)
+            {
+                ordered.push_back(GetHashKey<T>(rank));
+            }
+        }
+
+        keys.resize(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            keys[GetLookupIndex(i, size)] = ordered[i];
+        }
+    }
+    return keys;
+}
+
+// Distinct keys of `GetZipfHashKeys`, each one once.
+template <typename T>
+static const std::vector<T>& GetZipfDistinctHashKeys(size_t size)
+{
+    static std::vector<T> keys;
+    static size_t keysSize = 0;
+    if (keysSize != size)
+    {
+        std::unordered_map<T, T> seen;
+        keys.clear();
+        for (const T& key : GetZipfHashKeys<T>(size))
+        {
+            if (seen.insert({ key, key }).second)
+            {
+                keys.push_back(key);
+            }
+        }
+        keysSize = size;
+    }
+    return keys;
+}
+
+// Same as `HashMultiMap<T, T>`, but equal keys are stored in runs of consecutive slots of a Robin Hood table instead of
+// a single slot per key.
+template <typename T>
+using RunHashMultiMap = HashMultiMap<T, T, Hash<T>, EqualTo<T>, MallocAllocator<Pair<const T, T>>, RobinHoodHashLayout>;
+
+template <typename Map>
+static const Map& GetKwZipfHashMultiMap(size_t size)
+{
+    using T = typename Map::KeyType;
+
+    static Map map;
+    if (map.GetSize() != size)
+    {
+        map = Map();
+        const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            map.Insert({ keys[i], T(i) });
+        }
+    }
+    return map;
+}
+
+template <typename T>
+static const std::unordered_multimap<T, T>& GetStdZipfUnorderedMultimap(size_t size)
+{
+    static std::unordered_multimap<T, T> map;
+    if (map.size() != size)
+    {
+        map = std::unordered_multimap<T, T>();
+        const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            map.insert({ keys[i], T(i) });
+        }
+    }
+    return map;
+}
+
+KW_BENCHMARK_TEMPLATE(KwHashMultiMapInsertZipf, HashTypes, zipfSizes)
+{
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    HashMultiMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ keys[i], T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwRunHashMultiMapInsertZipf, HashTypes, zipfSizes)
+{
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    RunHashMultiMap<T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ keys[i], T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMultimapInsertZipf, HashTypes, zipfSizes)
+{
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    std::unordered_multimap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.insert({ keys[i], T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// Every key is counted as often as it's inserted, so frequent keys are looked up more often.
+KW_BENCHMARK_TEMPLATE(KwHashMultiMapCountZipf, HashTypes, zipfSizes)
+{
+    const HashMultiMap<T, T>& map = GetKwZipfHashMultiMap<HashMultiMap<T, T>>(size);
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Count(keys[i]);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwRunHashMultiMapCountZipf, HashTypes, zipfSizes)
+{
+    const RunHashMultiMap<T>& map = GetKwZipfHashMultiMap<RunHashMultiMap<T>>(size);
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Count(keys[i]);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMultimapCountZipf, HashTypes, zipfSizes)
+{
+    const std::unordered_multimap<T, T>& map = GetStdZipfUnorderedMultimap<T>(size);
+    const std::vector<T>& keys = GetZipfHashKeys<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.count(keys[i]);
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Visits every element once, through the ranges of all distinct keys.
+KW_BENCHMARK_TEMPLATE(KwHashMultiMapFindRangeZipf, HashTypes, zipfSizes)
+{
+    const HashMultiMap<T, T>& map = GetKwZipfHashMultiMap<HashMultiMap<T, T>>(size);
+    const std::vector<T>& keys = GetZipfDistinctHashKeys<T>(size);
+    T result = T();
+    for (const T& key : keys)
+    {
+        auto range = map.FindRange(key);
+        for (auto it = range.Key; it != range.Value; ++it)
+        {
+            result += it->Value;
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwRunHashMultiMapFindRangeZipf, HashTypes, zipfSizes)
+{
+    const RunHashMultiMap<T>& map = GetKwZipfHashMultiMap<RunHashMultiMap<T>>(size);
+    const std::vector<T>& keys = GetZipfDistinctHashKeys<T>(size);
+    T result = T();
+    for (const T& key : keys)
+    {
+        auto range = map.FindRange(key);
+        for (auto it = range.Key; it != range.Value; ++it)
+        {
+            result += it->Value;
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMultimapFindRangeZipf, HashTypes, zipfSizes)
+{
+    const std::unordered_multimap<T, T>& map = GetStdZipfUnorderedMultimap<T>(size);
+    const std::vector<T>& keys = GetZipfDistinctHashKeys<T>(size);
+    T result = T();
+    for (const T& key : keys)
+    {
+        auto range = map.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            result += it->second;
+        }
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Missing keys pay for every run of duplicates that their probe sequences cross.
+KW_BENCHMARK_TEMPLATE(KwHashMultiMapFindMissZipf, HashTypes, zipfSizes)
+{
+    const HashMultiMap<T, T>& map = GetKwZipfHashMultiMap<HashMultiMap<T, T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + i));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwRunHashMultiMapFindMissZipf, HashTypes, zipfSizes)
+{
+    const RunHashMultiMap<T>& map = GetKwZipfHashMultiMap<RunHashMultiMap<T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Contains(GetHashKey<T>(size + i));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMultimapFindMissZipf, HashTypes, zipfSizes)
+{
+    const std::unordered_multimap<T, T>& map = GetStdZipfUnorderedMultimap<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.count(GetHashKey<T>(size + i));
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Elements of a table that is built at once from a range, e.g. a lookup table loaded at startup.
+template <typename T>
+static const std::vector<Pair<const T, T>>& GetHashBuildElements(size_t size)
+{
+    static std::vector<Pair<const T, T>> elements;
+    if (elements.size() != size)
+    {
+        elements.clear();
+        for (size_t i = 0; i < size; i++)
+        {
+            elements.push_back({ GetHashKey<T>(i), T(i) });
+        }
+    }
+    return elements;
+}
+
+// Growing the table over and over, and inserting at random places of a table that doesn't fit into the cache.
+KW_BENCHMARK_TEMPLATE(KwHashMapBuildInsert, HashTypes, hashSizes)
+{
+    const std::vector<Pair<const T, T>>& elements = GetHashBuildElements<T>(size);
+    HashMap<T, T> map;
+    for (const Pair<const T, T>& element : elements)
+    {
+        map.Insert(element);
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// The table is sized once, and large ranges are partitioned by home slot, so the table is filled front to back.
+KW_BENCHMARK_TEMPLATE(KwHashMapBuildRange, HashTypes, hashSizes)
+{
+    const std::vector<Pair<const T, T>>& elements = GetHashBuildElements<T>(size);
+    HashMap<T, T> map(elements.data(), elements.data() + elements.size());
+    KW_DONT_OPTIMIZE(map);
+}
+
+// Same as above, but elements are hashed and partitioned on all hardware threads.
+KW_BENCHMARK_TEMPLATE(KwHashMapBuildRangeParallel, HashTypes, hashSizes)
+{
+    const std::vector<Pair<const T, T>>& elements = GetHashBuildElements<T>(size);
+    HashMap<T, T> map(elements.data(), elements.data() + elements.size(), std::thread::hardware_concurrency());
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSwissHashMapBuildRange, HashTypes, hashSizes)
+{
+    const std::vector<Pair<const T, T>>& elements = GetHashBuildElements<T>(size);
+    SwissHashMap<T> map(elements.data(), elements.data() + elements.size());
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(StdUnorderedMapBuildRange, HashTypes, hashSizes)
+{
+    const std::vector<Pair<const T, T>>& elements = GetHashBuildElements<T>(size);
+    std::unordered_map<T, T> map;
+    map.reserve(size);
+    for (const Pair<const T, T>& element : elements)
+    {
+        map.insert({ element.Key, element.Value });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+// Thread counts of the concurrent benchmarks. Every run performs the same number of operations split evenly between the
+// threads, so the throughput in operations per second is `concurrentOperationCount` divided by the run time.
+static const size_t concurrentThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+static const size_t concurrentOperationCount = 262144;
+
+// Keys of a shared cache, e.g. sessions. Operations pick them at random, so half of the lookups miss.
+static const size_t concurrentKeyCount = 65536;
+
+// What request handling threads do without a concurrent map: every operation takes the same lock.
+template <typename T>
+struct MutexHashMap
+{
+    bool Find(const T& key, T& result)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = map.Find(key);
+        if (it == map.GetEnd())
+        {
+            return false;
+        }
+        result = it->Value;
+        return true;
+    }
+
+    void InsertOrAssign(const T& key, const T& value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        map[key] = value;
+    }
+
+    void Erase(const T& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        map.Erase(key);
+    }
+
+    std::mutex mutex;
+    HashMap<T, T> map;
+};
+
+// Of the operations that aren't lookups, nine in ten insert or assign a key, and the rest erase one.
+template <typename T, typename Map>
+static void RunConcurrentOperations(Map& map, size_t threadCount, size_t lookupPercent)
+{
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < threadCount; thread++)
+    {
+        threads.emplace_back([&map, thread, threadCount, lookupPercent]()
+        {
+            // Each thread has its own xorshift state, so picking operations doesn't share memory between threads.
+            uint64_t state = (thread + 1) * 0x9E3779B97F4A7C15ULL;
+            T result = T();
+            for (size_t i = 0; i < concurrentOperationCount / threadCount; i++)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                T key = GetHashKey<T>((state >> 16) % concurrentKeyCount);
+                size_t operation = state % 100;
+                if (operation < lookupPercent)
+                {
+                    map.Find(key, result);
+                }
+                else if (operation < lookupPercent + (100 - lookupPercent) * 9 / 10)
+                {
+                    map.InsertOrAssign(key, T(i));
+                }
+                else
+                {
+                    map.Erase(key);
+                }
+            }
+            KW_DONT_OPTIMIZE(result);
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+KW_BENCHMARK_TEMPLATE(KwConcurrentHashMapReadMostly, HashTypes, concurrentThreadCounts)
+{
+    static ConcurrentHashMap<T, T> map;
+    RunConcurrentOperations<T>(map, size, 90);
+}
+
+KW_BENCHMARK_TEMPLATE(MutexHashMapReadMostly, HashTypes, concurrentThreadCounts)
+{
+    static MutexHashMap<T> map;
+    RunConcurrentOperations<T>(map, size, 90);
+}
+
+KW_BENCHMARK_TEMPLATE(KwConcurrentHashMapWriteHeavy, HashTypes, concurrentThreadCounts)
+{
+    static ConcurrentHashMap<T, T> map;
+    RunConcurrentOperations<T>(map, size, 50);
+}
+
+KW_BENCHMARK_TEMPLATE(MutexHashMapWriteHeavy, HashTypes, concurrentThreadCounts)
+{
+    static MutexHashMap<T> map;
+    RunConcurrentOperations<T>(map, size, 50);
+}
+
+// Lookups only, e.g. a routing table that changes a few times a day. Readers refresh their view once per request.
+static const size_t snapshotRequestSize = 64;
+
+template <typename Map>
+static Map& GetConcurrentReadMap()
+{
+    static Map map;
+    static bool initialized = false;
+    if (!initialized)
+    {
+        for (size_t i = 0; i < concurrentKeyCount; i++)
+        {
+            using T = typename Map::KeyType;
+            map.InsertOrAssign(GetHashKey<T>(i), T(i));
+        }
+        initialized = true;
+    }
+    return map;
+}
+
+// Readers of a snapshot map don't write to any shared memory, so lookups scale with the number of threads.
+KW_BENCHMARK_TEMPLATE(KwSnapshotHashMapRead, HashTypes, concurrentThreadCounts)
+{
+    SnapshotHashMap<T, T>& map = GetConcurrentReadMap<SnapshotHashMap<T, T>>();
+
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < size; thread++)
+    {
+        threads.emplace_back([&map, thread, size]()
+        {
+            typename SnapshotHashMap<T, T>::Reader reader(map);
+            size_t result = 0;
+            for (size_t i = 0; i < concurrentOperationCount / size; i++)
+            {
+                if (i % snapshotRequestSize == 0)
+                {
+                    reader.Refresh();
+                }
+                result += reader.Contains(GetHashKey<T>(GetLookupIndex(thread + i, concurrentKeyCount)));
+            }
+            KW_DONT_OPTIMIZE(result);
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Even a shared lock writes to the cache line of its mutex, so readers of the same shard contend for it.
+KW_BENCHMARK_TEMPLATE(KwConcurrentHashMapRead, HashTypes, concurrentThreadCounts)
+{
+    ConcurrentHashMap<T, T>& map = GetConcurrentReadMap<ConcurrentHashMap<T, T>>();
+    RunConcurrentOperations<T>(map, size, 100);
+}
+
+template <typename T>
+static const std::map<T, T>& GetStdMap(size_t size)
+{
+    static std::map<T, T> map;
+    if (map.size() != size)
+    {
+        map = std::map<T, T>();
+        for (size_t i = 0; i < size; i++)
+        {
+            map.insert({ GetHashKey<T>(i), T(i) });
+        }
+    }
+    return map;
+}
+
+// Keys are inserted in a scrambled order, so B-tree leaves split in the middle and end up partially full, like in
+// tables built from unsorted data.
+KW_BENCHMARK_TEMPLATE(KwOrderedMapInsert, HashTypes, hashSizes)
+{
+    OrderedMap<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.Insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMapInsert, HashTypes, hashSizes)
+{
+    std::map<T, T> map;
+    for (size_t i = 0; i < size; i++)
+    {
+        map.insert({ GetHashKey<T>(i), T(i) });
+    }
+    KW_DONT_OPTIMIZE(map);
+}
+
+KW_BENCHMARK_TEMPLATE(KwOrderedMapFindHit, HashTypes, hashSizes)
+{
+    const OrderedMap<T, T>& map = GetKwHashMap<OrderedMap<T, T>>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.Find(GetHashKey<T>(GetLookupIndex(i, size)))->Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMapFindHit, HashTypes, hashSizes)
+{
+    const std::map<T, T>& map = GetStdMap<T>(size);
+    T result = T();
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.find(GetHashKey<T>(GetLookupIndex(i, size)))->second;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+// Missing keys land between the existing ones, so the bound is a neighbour of the given key, or the end.
+KW_BENCHMARK_TEMPLATE(KwOrderedMapLowerBound, HashTypes, hashSizes)
+{
+    const OrderedMap<T, T>& map = GetKwHashMap<OrderedMap<T, T>>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.LowerBound(GetHashKey<T>(size + GetLookupIndex(i, size))) != map.GetEnd();
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMapLowerBound, HashTypes, hashSizes)
+{
+    const std::map<T, T>& map = GetStdMap<T>(size);
+    size_t result = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        result += map.lower_bound(GetHashKey<T>(size + GetLookupIndex(i, size))) != map.end();
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwOrderedMapIterate, HashTypes, hashSizes)
+{
+    const OrderedMap<T, T>& map = GetKwHashMap<OrderedMap<T, T>>(size);
+    T result = T();
+    for (const Pair<const T, T>& element : map)
+    {
+        result += element.Value;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdMapIterate, HashTypes, hashSizes)
+{
+    const std::map<T, T>& map = GetStdMap<T>(size);
+    T result = T();
+    for (const std::pair<const T, T>& element : map)
+    {
+        result += element.second;
+    }
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorCount, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorValue, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size, T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorInitializerList, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value{ T() };
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorIterator, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(other.GetBegin(), other.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorCopy, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(other);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorConstructorMove, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(Move(other));
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorAssignmentCopy, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    value = other;
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorAssignmentMove, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    value = Move(other);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorAssignmentInitializerList, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    value = { T() };
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorAssignCount, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    value.Assign(size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorAssignCountValue, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    value.Assign(size, T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorReserve, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value;
+    value.Reserve(size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorClear, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size);
+    value.Clear();
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertSingleBegin, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size);
+    value.Insert(value.GetBegin(), T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertSingleMiddle, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size);
+    value.Insert(value.GetBegin() + value.GetSize() / 2, T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertSingleEnd, DefaultTypes, defaultSizes)
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size);
+    value.Insert(value.GetEnd(), T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertRangeBegin, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Insert(value.GetBegin(), other.GetBegin(), other.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertRangeMiddle, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Insert(value.GetBegin() + value.GetSize() / 2, other.GetBegin(), other.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorInsertRangeEnd, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> other(size);
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Insert(value.GetEnd(), other.GetBegin(), other.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseSingleBegin, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Erase(value.GetBegin());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseSingleMiddle, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Erase(value.GetBegin() + value.GetSize() / 2);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseSingleEnd, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.Erase(value.GetEnd() - 1);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseRangeBegin, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size + 16);
+    value.Erase(value.GetBegin(), value.GetBegin() + size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseRangeMiddle, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size + 16);
+    size_t beginIndex = value.GetSize() / 2 / size * size;
+    value.Erase(value.GetBegin() + beginIndex, value.GetBegin() + beginIndex + size);
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEraseRangeEnd, DefaultTypes, KW_LIST(8, 64, 512))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(size + 16);
+    value.Erase(value.GetEnd() - size, value.GetEnd());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorPushBackValue, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.PushBack(T());
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorPushBackMove, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    T other;
+    value.PushBack(Move(other));
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorEmplaceBack, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.EmplaceBack();
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(KwSmallVectorPopBack, DefaultTypes, KW_LIST(1))
+{
+    SmallVector<T, smallVectorSize, BenchmarkAllocator<T>> value(16);
+    value.PopBack();
+    KW_DONT_OPTIMIZE(value);
+}
+
+KW_BENCHMARK_TEMPLATE(StdVectorFind, ArithmeticTypes, defaultSizes)
+{
+    std::vector<T, BenchmarkAllocator<T>> value(size);
+    auto result = std::find(value.begin(), value.end(), T(1));
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdVectorCount, ArithmeticTypes, defaultSizes)
+{
+    std::vector<T, BenchmarkAllocator<T>> value(size);
+    size_t result = std::count(value.begin(), value.end(), T(0));
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdVectorEqual, ArithmeticTypes, defaultSizes)
+{
+    std::vector<T, BenchmarkAllocator<T>> value(size);
+    std::vector<T, BenchmarkAllocator<T>> other(size);
+    bool result = value == other;
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdVectorCompare, ArithmeticTypes, defaultSizes)
+{
+    std::vector<T, BenchmarkAllocator<T>> value(size);
+    std::vector<T, BenchmarkAllocator<T>> other(size);
+    bool result = value < other;
+    KW_DONT_OPTIMIZE(result);
+}
+
+KW_BENCHMARK_TEMPLATE(StdVectorMin, ArithmeticTypes, defaultSizes)
+{
+    std::vector<T, BenchmarkAllocator<T>> value(size);
+    T result = *std::min_element(value.begin(), value.end());
+    KW_DONT_OPTIMIZE(result);
+}
+
 KW_BENCHMARK_TEMPLATE(StdVectorConstructorCount, DefaultTypes, defaultSizes)
 {
     std::vector<T, BenchmarkAllocator<T>> value(size);